@@ -0,0 +1,83 @@
+#include "admission.h"
+
+AdmissionControl::AdmissionControl(int max_running, int max_queued)
+    : max_running(max_running), max_queued(max_queued), waiting(mutex), stats() {
+    stats.max_running = max_running;
+    stats.max_queued = max_queued;
+}
+
+bool AdmissionControl::Admit(const gaia::cancellation_token& token, std::function<void()> start, std::function<void()> cancelled) {
+    unsigned long waiter = 0;
+    bool queued = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (max_running < 0 || stats.running < max_running) {
+            ++stats.running;
+            ++stats.admitted;
+        } else if (max_queued >= 0 && stats.queued >= max_queued) {
+            ++stats.rejected;
+            return false;
+        } else {
+            queued = true;
+            waiter = waiting.Push(token, std::move(start), 0);
+            ++stats.queued;
+            if (stats.queued > stats.max_queue_depth) {
+                stats.max_queue_depth = stats.queued;
+            }
+        }
+    }
+    if (!queued) {
+        start();
+        return true;
+    }
+    waiting.Watch(waiter, cancelled, [this](std::vector<WaitQueue::Waiter>&) {
+        --stats.queued;
+        ++stats.cancelled;
+    });
+    return true;
+}
+
+void AdmissionControl::Release() {
+    std::vector<WaitQueue::Waiter> ready;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        --stats.running;
+        Dequeue(ready);
+    }
+    WaitQueue::Start(ready);
+}
+
+void AdmissionControl::SetMaxRunning(int limit) {
+    std::vector<WaitQueue::Waiter> ready;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        max_running = limit;
+        stats.max_running = limit;
+        Dequeue(ready);
+    }
+    WaitQueue::Start(ready);
+}
+
+void AdmissionControl::Dequeue(std::vector<WaitQueue::Waiter>& ready) {
+    // Free slots go straight to the waiting jobs. A lowered limit takes
+    // effect as running jobs finish.
+    while (!waiting.Empty() && (max_running < 0 || stats.running < max_running)) {
+        waiting.Take(waiting.begin(), ready);
+        --stats.queued;
+        ++stats.running;
+        ++stats.admitted;
+
+        long waited = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - ready.back().queued_at).count();
+        ++stats.waited;
+        stats.total_wait_us += waited;
+        if (waited > stats.max_wait_us) {
+            stats.max_wait_us = waited;
+        }
+    }
+}
+
+gaia::admission_stats AdmissionControl::Stats() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return stats;
+}
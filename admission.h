@@ -0,0 +1,48 @@
+#ifndef ADMISSION_H
+#define ADMISSION_H
+
+#include <functional>
+#include <mutex>
+#include <vector>
+#include "sdk.h"
+#include "wait_queue.h"
+
+// AdmissionControl limits the number of jobs which run at the same time.
+// Jobs beyond the limit wait in a bounded first in, first out queue and
+// are rejected right away once the queue is full, so a burst of calls
+// neither piles up threads nor memory. Safe for concurrent use.
+class AdmissionControl {
+    public:
+        // A negative max_running or max_queued removes the limit.
+        AdmissionControl(int max_running, int max_queued);
+
+        // Admit calls start once the job may run, right away if a slot is
+        // free. If the token fires while the job waits, cancelled is called
+        // instead. Returns false without calling either if the queue is
+        // full. Every started job must be released.
+        bool Admit(const gaia::cancellation_token& token, std::function<void()> start, std::function<void()> cancelled);
+
+        // Release frees the slot of a finished job and starts the next
+        // waiting one.
+        void Release();
+
+        // SetMaxRunning changes the number of jobs which run at the same
+        // time. Waiting jobs start right away if the limit grows.
+        void SetMaxRunning(int limit);
+
+        // Stats returns a snapshot of the admission metrics.
+        gaia::admission_stats Stats() const;
+
+    private:
+        int max_running;
+        const int max_queued;
+        mutable std::mutex mutex;
+        WaitQueue waiting;
+        gaia::admission_stats stats;
+
+        // Dequeue moves the waiters which fit into the limit to ready.
+        // Called with the lock held.
+        void Dequeue(std::vector<WaitQueue::Waiter>& ready);
+};
+
+#endif
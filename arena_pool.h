@@ -0,0 +1,58 @@
+#ifndef ARENA_POOL_H
+#define ARENA_POOL_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include <google/protobuf/arena.h>
+
+// ArenaPool recycles protobuf arenas between async execution calls. Every
+// thread keeps its own free list, so taking and returning an arena needs
+// no lock. An arena goes back to the list of the poller which finishes its
+// call. Every arena keeps its initial block across Reset, so once the
+// lists are warm the responses are allocated without touching the heap.
+// Requests are decoded in place by JobRequest and need no arena. The
+// synchronous server cannot use arenas, gRPC allocates its messages.
+class ArenaPool {
+    public:
+        // Size of the initial block of every arena.
+        static const size_t BLOCK_SIZE = 8192;
+
+        // Slot is an arena together with its initial block.
+        struct Slot {
+            Slot() : block(new char[BLOCK_SIZE]), arena(Options(block.get())) {}
+
+            static google::protobuf::ArenaOptions Options(char* block) {
+                google::protobuf::ArenaOptions options;
+                options.initial_block = block;
+                options.initial_block_size = BLOCK_SIZE;
+                return options;
+            }
+
+            std::unique_ptr<char[]> block;
+            google::protobuf::Arena arena;
+        };
+
+        static Slot* Acquire() {
+            std::vector<std::unique_ptr<Slot>>& free_slots = FreeSlots();
+            if (free_slots.empty()) {
+                return new Slot();
+            }
+            Slot* slot = free_slots.back().release();
+            free_slots.pop_back();
+            return slot;
+        }
+
+        static void Release(Slot* slot) {
+            slot->arena.Reset();
+            FreeSlots().push_back(std::unique_ptr<Slot>(slot));
+        }
+
+    private:
+        static std::vector<std::unique_ptr<Slot>>& FreeSlots() {
+            thread_local std::vector<std::unique_ptr<Slot>> free_slots;
+            return free_slots;
+        }
+};
+
+#endif
@@ -0,0 +1,104 @@
+// arena_benchmark counts the heap allocations of the JobResult of an
+// execution call allocated on the heap, as before, and on an arena of the
+// ArenaPool. It also times both with several threads at once, where heap
+// allocations contend in the allocator. Times are for ITERATIONS calls on
+// every thread.
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../arena_pool.h"
+#include "../plugin.pb.h"
+#include "benchmark.h"
+
+static const int ITERATIONS = 200000;
+static const int THREADS = 8;
+
+static std::atomic<long> allocations(0);
+
+void* operator new(size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    void* p = std::malloc(size == 0 ? 1 : size);
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    std::free(p);
+}
+
+static const std::string MESSAGE = "job failed with an error message longer than the small string buffer";
+
+// succeeded and failed set the fields of a result like the SDK does.
+static void succeeded(proto::JobResult* result, int i) {
+    result->set_unique_id(i);
+    result->set_unique_id64(i);
+}
+
+static void failed(proto::JobResult* result, int i) {
+    succeeded(result, i);
+    result->set_failed(true);
+    result->set_exit_pipeline(true);
+    result->set_message(MESSAGE);
+}
+
+template <void (*fill)(proto::JobResult*, int)>
+static void heap_call(int i) {
+    proto::JobResult* result = new proto::JobResult();
+    fill(result, i);
+    delete result;
+}
+
+template <void (*fill)(proto::JobResult*, int)>
+static void arena_call(int i) {
+    ArenaPool::Slot* slot = ArenaPool::Acquire();
+    proto::JobResult* result = google::protobuf::Arena::CreateMessage<proto::JobResult>(&slot->arena);
+    fill(result, i);
+    ArenaPool::Release(slot);
+}
+
+// count returns the heap allocations of a single call once warm.
+static double count(void (*call)(int)) {
+    call(0);
+    long before = allocations.load();
+    for (int i = 0; i < ITERATIONS; ++i) {
+        call(i);
+    }
+    return (double)(allocations.load() - before) / ITERATIONS;
+}
+
+// parallel runs ITERATIONS calls on each of THREADS threads.
+static void parallel(void (*call)(int)) {
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.push_back(std::thread([call]() {
+            for (int i = 0; i < ITERATIONS; ++i) {
+                call(i);
+            }
+        }));
+    }
+    for (auto & thread : threads) {
+        thread.join();
+    }
+}
+
+int main() {
+    std::printf("%-40s %12.2f\n", "allocations, succeeded, heap", count(heap_call<succeeded>));
+    std::printf("%-40s %12.2f\n", "allocations, succeeded, arena pool", count(arena_call<succeeded>));
+    std::printf("%-40s %12.2f\n", "allocations, failed, heap", count(heap_call<failed>));
+    std::printf("%-40s %12.2f\n", "allocations, failed, arena pool", count(arena_call<failed>));
+    Measure("8 threads, succeeded, heap", 5, []() { parallel(heap_call<succeeded>); });
+    Measure("8 threads, succeeded, arena pool", 5, []() { parallel(arena_call<succeeded>); });
+    Measure("8 threads, failed, heap", 5, []() { parallel(heap_call<failed>); });
+    Measure("8 threads, failed, arena pool", 5, []() { parallel(arena_call<failed>); });
+    return 0;
+}
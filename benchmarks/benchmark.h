@@ -0,0 +1,24 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <chrono>
+#include <cstdio>
+#include <functional>
+
+// Measure runs body iterations times after a short warm up and prints
+// the average time of a single iteration.
+inline double Measure(const char* name, int iterations, const std::function<void()>& body) {
+    for (int i = 0; i < iterations / 10 + 1; ++i) {
+        body();
+    }
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        body();
+    }
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    double per_iteration = elapsed.count() / iterations;
+    std::printf("%-40s %12.2f us\n", name, per_iteration);
+    return per_iteration;
+}
+
+#endif
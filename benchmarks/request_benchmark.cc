@@ -0,0 +1,46 @@
+// request_benchmark compares decoding an ExecuteJob request with the
+// generated Job::ParseFromString, as the synchronous server does, with
+// JobRequest, which only reads the ids and argument keys and values.
+#include <string>
+#include "../request.h"
+#include "benchmark.h"
+
+static const int ARGS = 20;
+static const size_t DESCRIPTION_SIZE = 4096;
+static const size_t VALUE_SIZE = 64;
+static const int ITERATIONS = 200000;
+
+int main() {
+    // A job like Gaia sends it, with title, description and interaction.
+    proto::Job job;
+    job.set_unique_id(1);
+    job.set_unique_id64(1);
+    job.set_title("Deploy");
+    job.set_description(std::string(DESCRIPTION_SIZE, 'd'));
+    for (int a = 0; a < ARGS; ++a) {
+        proto::Argument* arg = job.add_args();
+        arg->set_description("argument " + std::to_string(a) + " of the job");
+        arg->set_type("textfield");
+        arg->set_key("key" + std::to_string(a));
+        arg->set_value(std::string(VALUE_SIZE, 'v'));
+    }
+    job.mutable_interaction()->set_description("Confirm the deployment");
+    job.mutable_interaction()->set_type("boolean");
+    std::string bytes;
+    job.SerializeToString(&bytes);
+
+    // Every call decodes into a new message.
+    size_t decoded = 0;
+    double generated = Measure("Job::ParseFromString", ITERATIONS, [&bytes, &decoded]() {
+        proto::Job request;
+        request.ParseFromString(bytes);
+        decoded += request.args_size();
+    });
+    double partial = Measure("JobRequest::Parse", ITERATIONS, [&bytes, &decoded]() {
+        JobRequest request;
+        request.Parse(bytes.data(), bytes.size());
+        decoded += request.Arguments().size();
+    });
+    std::printf("speedup %.1fx (%zu arguments decoded)\n", generated / partial, decoded);
+    return 0;
+}
@@ -0,0 +1,154 @@
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include "cgroup.h"
+
+static const char* MOUNTINFO_PATH = "/proc/self/mountinfo";
+static const char* CGROUP_PATH = "/proc/self/cgroup";
+static const char* MEMINFO_PATH = "/proc/meminfo";
+
+// cgroup2_mount returns the mount point of the cgroup v2 hierarchy and
+// sets root to the group mounted there. Inside nested or namespaced
+// cgroups the root is not "/".
+static std::string cgroup2_mount(std::string& root) {
+    std::ifstream mountinfo(MOUNTINFO_PATH);
+    std::string line;
+    while (std::getline(mountinfo, line)) {
+        // The filesystem type follows the " - " separator.
+        size_t separator = line.find(" - ");
+        if (separator == std::string::npos || line.compare(separator + 3, 8, "cgroup2 ") != 0) {
+            continue;
+        }
+        // The root and the mount point are the fourth and fifth field.
+        std::istringstream fields(line);
+        std::string field, mount_point;
+        for (int i = 0; i < 5 && fields >> field; ++i) {
+            if (i == 3) {
+                root = field;
+            }
+            mount_point = field;
+        }
+        return mount_point;
+    }
+    return "";
+}
+
+// cgroup2_path returns the path of the cgroup v2 group of the process.
+static std::string cgroup2_path() {
+    std::ifstream cgroup(CGROUP_PATH);
+    std::string line;
+    while (std::getline(cgroup, line)) {
+        if (line.compare(0, 3, "0::") == 0) {
+            return line.substr(3);
+        }
+    }
+    return "";
+}
+
+// cgroup2_group returns the group of the process relative to the given
+// mount root, or "" if it is not below the root.
+static std::string cgroup2_group(const std::string& root) {
+    std::string path = cgroup2_path();
+    if (path.empty() || root == "/") {
+        return path;
+    }
+    if (path.compare(0, root.size(), root) != 0) {
+        return "";
+    } else if (path.size() == root.size()) {
+        return "/";
+    } else if (path[root.size()] != '/') {
+        return "";
+    }
+    return path.substr(root.size());
+}
+
+// read_cpu_max returns the cores granted by a cpu.max file, 0 if none.
+static double read_cpu_max(const std::string& path) {
+    std::ifstream file(path.c_str());
+    std::string quota;
+    double period = 0;
+    if (!(file >> quota >> period) || quota == "max" || period <= 0) {
+        return 0;
+    }
+    char* end;
+    double value = std::strtod(quota.c_str(), &end);
+    return *end == '\0' ? value / period : 0;
+}
+
+// read_memory_max returns the bytes granted by a memory.max file, 0 if none.
+static size_t read_memory_max(const std::string& path) {
+    std::ifstream file(path.c_str());
+    std::string limit;
+    if (!(file >> limit) || limit == "max") {
+        return 0;
+    }
+    char* end;
+    unsigned long long value = std::strtoull(limit.c_str(), &end, 10);
+    return *end == '\0' ? value : 0;
+}
+
+// read_meminfo returns the total and available memory of the host.
+static memory_usage read_meminfo() {
+    memory_usage usage = {};
+    std::ifstream meminfo(MEMINFO_PATH);
+    std::string key;
+    size_t value;
+    std::string unit;
+    size_t available = 0;
+    while (meminfo >> key >> value >> unit) {
+        if (key == "MemTotal:") {
+            usage.limit = value * 1024;
+        } else if (key == "MemAvailable:") {
+            available = value * 1024;
+        }
+    }
+    usage.used = usage.limit > available ? usage.limit - available : 0;
+    return usage;
+}
+
+container_limits ReadContainerLimits() {
+    container_limits limits = {};
+    std::string root;
+    std::string mount = cgroup2_mount(root);
+    std::string group = cgroup2_group(root);
+    if (mount.empty() || group.empty()) {
+        return limits;
+    }
+
+    // Limits of a parent apply to all its children, so walk up to the
+    // mount root. Groups above it are not visible.
+    for (;;) {
+        std::string dir = mount + (group == "/" ? "" : group);
+        double cpus = read_cpu_max(dir + "/cpu.max");
+        if (cpus > 0 && (limits.cpus == 0 || cpus < limits.cpus)) {
+            limits.cpus = cpus;
+        }
+        size_t memory = read_memory_max(dir + "/memory.max");
+        if (memory > 0 && (limits.memory == 0 || memory < limits.memory)) {
+            limits.memory = memory;
+        }
+        if (group == "/" || group.empty()) {
+            break;
+        }
+        size_t parent = group.rfind('/');
+        group = parent == 0 ? "/" : group.substr(0, parent);
+    }
+    return limits;
+}
+
+memory_usage ReadMemoryUsage() {
+    memory_usage usage = {};
+    usage.limit = ReadContainerLimits().memory;
+    std::string root;
+    std::string mount = cgroup2_mount(root);
+    std::string group = cgroup2_group(root);
+    if (usage.limit == 0 || mount.empty() || group.empty()) {
+        return read_meminfo();
+    }
+    std::ifstream current((mount + (group == "/" ? "" : group) + "/memory.current").c_str());
+    if (!(current >> usage.used)) {
+        return read_meminfo();
+    }
+    return usage;
+}
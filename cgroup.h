@@ -0,0 +1,30 @@
+#ifndef CGROUP_H
+#define CGROUP_H
+
+#include <cstddef>
+
+// container_limits are the resource limits of the cgroup v2 hierarchy
+// the plugin runs in. Zero means no limit.
+struct container_limits {
+    double cpus;
+    size_t memory;
+};
+
+// ReadContainerLimits reads cpu.max and memory.max of the cgroup of the
+// process and of all its parents and returns the tightest limits.
+// Without cgroup v2 no limits are returned.
+container_limits ReadContainerLimits();
+
+// memory_usage is the memory used by the plugin's group and the memory
+// available to it in bytes.
+struct memory_usage {
+    size_t used;
+    size_t limit;
+};
+
+// ReadMemoryUsage reads memory.current of the cgroup of the process
+// against its tightest memory limit. Without a cgroup memory limit the
+// memory of the host from /proc/meminfo is returned instead.
+memory_usage ReadMemoryUsage();
+
+#endif
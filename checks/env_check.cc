@@ -0,0 +1,46 @@
+// env_check checks how limits and counts are read from env variables.
+#include <cstdio>
+#include <cstdlib>
+#include "../env.h"
+
+static const char* NAME = "GAIA_PLUGIN_ENV_CHECK";
+static const int FALLBACK = 64;
+
+static int failures = 0;
+
+// expect_limit sets the env variable to value and compares the limit
+// read from it with expected.
+static void expect_limit(const char* value, int expected) {
+    setenv(NAME, value, 1);
+    int limit = ReadEnvLimit(NAME, FALLBACK);
+    if (limit != expected) {
+        std::printf("ReadEnvLimit(\"%s\") = %d, want %d\n", value, limit, expected);
+        ++failures;
+    }
+}
+
+int main() {
+    unsetenv(NAME);
+    if (ReadEnvLimit(NAME, FALLBACK) != FALLBACK) {
+        std::printf("ReadEnvLimit of an unset variable is not the fallback\n");
+        ++failures;
+    }
+    expect_limit("-1", -1);
+    expect_limit("8", 8);
+    expect_limit("0", FALLBACK);
+    expect_limit("-2", FALLBACK);
+    expect_limit("", FALLBACK);
+    expect_limit("8x", FALLBACK);
+    expect_limit("unlimited", FALLBACK);
+    expect_limit("99999999999", FALLBACK);
+
+    setenv(NAME, "-1", 1);
+    if (ReadEnvInt(NAME, FALLBACK) != FALLBACK) {
+        std::printf("ReadEnvInt(\"-1\") is not the fallback\n");
+        ++failures;
+    }
+    if (failures == 0) {
+        std::printf("env_check passed\n");
+    }
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,25 @@
+#include <climits>
+#include <cstdlib>
+#include "env.h"
+
+int ReadEnvInt(const std::string& name, int fallback) {
+    char* value_p = std::getenv(name.c_str());
+    if (value_p == nullptr) {
+        return fallback;
+    }
+    int value = std::atoi(value_p);
+    return value > 0 ? value : fallback;
+}
+
+int ReadEnvLimit(const std::string& name, int fallback) {
+    char* value_p = std::getenv(name.c_str());
+    if (value_p == nullptr || *value_p == '\0') {
+        return fallback;
+    }
+    char* end;
+    long value = std::strtol(value_p, &end, 10);
+    if (*end != '\0' || value == 0 || value < -1 || value > INT_MAX) {
+        return fallback;
+    }
+    return (int)value;
+}
@@ -0,0 +1,15 @@
+#ifndef ENV_H
+#define ENV_H
+
+#include <string>
+
+// ReadEnvInt returns the positive integer stored in the given env
+// variable or the fallback if it is not set or invalid.
+int ReadEnvInt(const std::string& name, int fallback);
+
+// ReadEnvLimit returns the limit stored in the given env variable, which
+// is a positive integer or -1 for no limit, or the fallback if it is not
+// set or invalid.
+int ReadEnvLimit(const std::string& name, int fallback);
+
+#endif
@@ -0,0 +1,116 @@
+#include "executor.h"
+
+// Identifies the executor and worker the current thread belongs to.
+static thread_local const JobExecutor* current_executor = nullptr;
+static thread_local int current_worker = -1;
+
+JobExecutor::JobExecutor(int thread_count)
+    : stopping(false), next_worker(0), queued(0), running(0), completed(0), stolen(0), max_queued(0) {
+    if (thread_count < 1) {
+        thread_count = 1;
+    }
+    for (int i = 0; i < thread_count; ++i) {
+        workers.push_back(std::unique_ptr<Worker>(new Worker()));
+    }
+    for (int i = 0; i < thread_count; ++i) {
+        threads.push_back(std::thread(&JobExecutor::Run, this, i));
+    }
+}
+
+JobExecutor::~JobExecutor() {
+    {
+        std::lock_guard<std::mutex> lock(idle_mutex);
+        stopping = true;
+    }
+    idle_cv.notify_all();
+    for (auto & thread : threads) {
+        thread.join();
+    }
+}
+
+void JobExecutor::Submit(std::function<void()> task) {
+    int index = current_worker;
+    if (current_executor != this) {
+        index = next_worker.fetch_add(1) % workers.size();
+    }
+    {
+        std::lock_guard<std::mutex> lock(workers[index]->mutex);
+        workers[index]->tasks.push_back(std::move(task));
+    }
+
+    // Track the queue high-water mark.
+    long depth = queued.fetch_add(1) + 1;
+    long max = max_queued.load();
+    while (depth > max && !max_queued.compare_exchange_weak(max, depth)) {}
+
+    // Taking the idle lock makes sure a worker that just found all
+    // deques empty is already waiting when we notify.
+    {
+        std::lock_guard<std::mutex> lock(idle_mutex);
+    }
+    idle_cv.notify_one();
+}
+
+gaia::executor_stats JobExecutor::Stats() const {
+    gaia::executor_stats stats = {};
+    stats.threads = threads.size();
+    stats.queued = queued.load();
+    stats.running = running.load();
+    stats.completed = completed.load();
+    stats.stolen = stolen.load();
+    stats.max_queued = max_queued.load();
+    return stats;
+}
+
+void JobExecutor::Run(int index) {
+    current_executor = this;
+    current_worker = index;
+
+    std::function<void()> task;
+    for (;;) {
+        if (Pop(index, task) || Steal(index, task)) {
+            queued--;
+            running++;
+            try {
+                task();
+            } catch (...) {
+                // Tasks handle their own errors. Never lose a worker.
+            }
+            task = nullptr;
+            running--;
+            completed++;
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(idle_mutex);
+        idle_cv.wait(lock, [this]() { return stopping || queued.load() > 0; });
+        if (stopping && queued.load() == 0) {
+            return;
+        }
+    }
+}
+
+bool JobExecutor::Pop(int index, std::function<void()>& task) {
+    Worker& worker = *workers[index];
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    if (worker.tasks.empty()) {
+        return false;
+    }
+    task = std::move(worker.tasks.front());
+    worker.tasks.pop_front();
+    return true;
+}
+
+bool JobExecutor::Steal(int index, std::function<void()>& task) {
+    for (size_t i = 1; i < workers.size(); ++i) {
+        Worker& victim = *workers[(index + i) % workers.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.back());
+            victim.tasks.pop_back();
+            stolen++;
+            return true;
+        }
+    }
+    return false;
+}
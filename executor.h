@@ -0,0 +1,53 @@
+#ifndef EXECUTOR_H
+#define EXECUTOR_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "sdk.h"
+
+// JobExecutor runs job handlers on its own fixed set of worker threads,
+// so handlers never run on a gRPC transport thread.
+// Every worker owns a task deque. Workers pop their own deque in FIFO
+// order and steal from the back of the other deques when they run dry.
+class JobExecutor {
+    public:
+        explicit JobExecutor(int thread_count);
+        ~JobExecutor();
+
+        // Submit queues the given task. Tasks submitted from a worker go
+        // to the worker's own deque, all others are spread round robin.
+        void Submit(std::function<void()> task);
+
+        // Stats returns a snapshot of the executor metrics.
+        gaia::executor_stats Stats() const;
+
+    private:
+        struct Worker {
+            std::mutex mutex;
+            std::deque<std::function<void()>> tasks;
+        };
+
+        std::vector<std::unique_ptr<Worker>> workers;
+        std::vector<std::thread> threads;
+        std::mutex idle_mutex;
+        std::condition_variable idle_cv;
+        bool stopping;
+        std::atomic<unsigned int> next_worker;
+        std::atomic<long> queued;
+        std::atomic<long> running;
+        std::atomic<long> completed;
+        std::atomic<long> stolen;
+        std::atomic<long> max_queued;
+
+        void Run(int index);
+        bool Pop(int index, std::function<void()>& task);
+        bool Steal(int index, std::function<void()>& task);
+};
+
+#endif
@@ -0,0 +1,106 @@
+#include <iostream>
+#include <sstream>
+#include "cgroup.h"
+#include "health.h"
+
+// Once the plugin stopped serving, every load has to drop below this
+// fraction of its threshold before it serves again, so it does not flap
+// around a threshold.
+static const double RECOVERY = 0.9;
+
+void HealthStatus::Attach(grpc::HealthCheckServiceInterface* health_service) {
+    std::lock_guard<std::mutex> lock(mutex);
+    service = health_service;
+    if (service != nullptr) {
+        for (auto const& entry : states) {
+            service->SetServingStatus(entry.first, entry.second);
+        }
+    }
+}
+
+void HealthStatus::Set(const std::string& name, bool serving) {
+    std::lock_guard<std::mutex> lock(mutex);
+    states[name] = serving;
+    if (service != nullptr) {
+        service->SetServingStatus(name, serving);
+    }
+}
+
+HealthMonitor::HealthMonitor(HealthStatus* status, const std::string& name, const JobExecutor* executor,
+                             const AdmissionControl* admission, health_thresholds thresholds, std::chrono::milliseconds interval)
+    : status(status), name(name), executor(executor), admission(admission), thresholds(thresholds),
+      interval(interval), serving(true), stopping(false) {}
+
+HealthMonitor::~HealthMonitor() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    cv.notify_all();
+    if (thread.joinable()) {
+        thread.join();
+    }
+}
+
+void HealthMonitor::Watch(const std::string& entry_name, std::function<bool(const gaia::admission_stats&)> overloaded) {
+    entries.push_back(Entry{entry_name, overloaded, true});
+    status->Set(entry_name, true);
+}
+
+void HealthMonitor::Start() {
+    thread = std::thread(&HealthMonitor::Run, this);
+}
+
+void HealthMonitor::Run() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!cv.wait_for(lock, interval, [this]() { return stopping; })) {
+        // A single snapshot of the admission metrics serves all entries.
+        gaia::admission_stats admitted = admission->Stats();
+        std::string reason;
+        bool now_serving = !Overloaded(admitted, reason);
+        if (now_serving != serving) {
+            serving = now_serving;
+            status->Set(name, serving);
+            // stdout is reserved for the handshake.
+            std::cerr << "gaia plugin: " << (serving ? "serving again" : "not serving, " + reason) << std::endl;
+        }
+        for (auto & entry : entries) {
+            bool entry_serving = serving && !entry.overloaded(admitted);
+            if (entry_serving != entry.serving) {
+                entry.serving = entry_serving;
+                status->Set(entry.name, entry_serving);
+            }
+        }
+    }
+}
+
+bool HealthMonitor::Overloaded(const gaia::admission_stats& admitted, std::string& reason) const {
+    std::ostringstream out;
+    auto crossed = [this, &out](const char* load, double value, int threshold, const char* unit) {
+        if (threshold < 0 || value <= (serving ? threshold : threshold * RECOVERY)) {
+            return false;
+        }
+        out << load << " " << (long)value << unit << " above " << threshold << unit;
+        return true;
+    };
+
+    gaia::executor_stats executed = executor->Stats();
+    double saturation = executed.threads > 0 ? (executed.running + executed.queued) * 100.0 / executed.threads : 0;
+    if (crossed("executor saturation", saturation, thresholds.saturation, "%")) {
+        reason = out.str();
+        return true;
+    }
+    if (crossed("queued jobs", admitted.queued, thresholds.queued_jobs, "")) {
+        reason = out.str();
+        return true;
+    }
+    if (thresholds.memory >= 0) {
+        memory_usage memory = ReadMemoryUsage();
+        double used = memory.limit > 0 ? memory.used * 100.0 / memory.limit : 0;
+        if (crossed("memory usage", used, thresholds.memory, "%")) {
+            reason = out.str();
+            return true;
+        }
+    }
+    return false;
+}
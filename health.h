@@ -0,0 +1,85 @@
+#ifndef HEALTH_H
+#define HEALTH_H
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <grpcpp/health_check_service_interface.h>
+#include "admission.h"
+#include "executor.h"
+
+// HealthStatus publishes serving states to the health check service of
+// the running server. States set before the server has started are
+// published once it is attached, later ones are dropped after detaching.
+class HealthStatus {
+    public:
+        void Attach(grpc::HealthCheckServiceInterface* health_service);
+        void Set(const std::string& name, bool serving);
+
+    private:
+        std::mutex mutex;
+        grpc::HealthCheckServiceInterface* service = nullptr;
+        std::map<std::string, bool> states;
+};
+
+// health_thresholds are the loads above which the plugin stops serving.
+// Executor saturation counts running and queued tasks in percent of the
+// executor threads, memory is in percent of the available memory. A
+// negative threshold is never crossed.
+struct health_thresholds {
+    int saturation;
+    int memory;
+    int queued_jobs;
+};
+
+// HealthMonitor samples the load of the plugin on its own thread and
+// switches the plugin entry of the health service to NOT_SERVING while
+// a threshold is crossed, so Gaia stops sending work before calls are
+// rejected.
+class HealthMonitor {
+    public:
+        HealthMonitor(HealthStatus* status, const std::string& name, const JobExecutor* executor,
+                      const AdmissionControl* admission, health_thresholds thresholds, std::chrono::milliseconds interval);
+        ~HealthMonitor();
+
+        // Watch adds an entry which serves while the plugin serves and
+        // overloaded returns false. overloaded gets the admission metrics
+        // sampled once per interval. Must be called before Start.
+        void Watch(const std::string& name, std::function<bool(const gaia::admission_stats&)> overloaded);
+
+        // Start begins sampling. The thread stops with the monitor.
+        void Start();
+
+    private:
+        struct Entry {
+            std::string name;
+            std::function<bool(const gaia::admission_stats&)> overloaded;
+            bool serving;
+        };
+
+        HealthStatus* status;
+        std::string name;
+        const JobExecutor* executor;
+        const AdmissionControl* admission;
+        health_thresholds thresholds;
+        std::chrono::milliseconds interval;
+        std::vector<Entry> entries;
+        bool serving;
+        bool stopping;
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::thread thread;
+
+        void Run();
+
+        // Overloaded returns true and the reason if a threshold is
+        // crossed.
+        bool Overloaded(const gaia::admission_stats& admitted, std::string& reason) const;
+};
+
+#endif
@@ -0,0 +1,100 @@
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include "history.h"
+
+// Weight of a new measurement in the moving average.
+static const double SMOOTHING = 0.25;
+
+// Interval in which the writer saves a changed history.
+static const std::chrono::seconds SAVE_INTERVAL(5);
+
+JobHistory::~JobHistory() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    cv.notify_all();
+    if (writer.joinable()) {
+        writer.join();
+    }
+}
+
+void JobHistory::Load(const std::string& history_path) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        path = history_path;
+        std::ifstream file(path.c_str());
+        uint64_t id;
+        double duration;
+        while (file >> id >> duration) {
+            if (duration >= 0) {
+                double& entry = durations[id];
+                total += duration - entry;
+                entry = duration;
+            }
+        }
+    }
+    writer = std::thread(&JobHistory::Run, this);
+}
+
+void JobHistory::Record(uint64_t id, std::chrono::microseconds duration) {
+    std::lock_guard<std::mutex> lock(mutex);
+    double sample = duration.count();
+    auto found = durations.find(id);
+    double change;
+    if (found == durations.end()) {
+        durations[id] = sample;
+        change = sample;
+    } else {
+        change = SMOOTHING * (sample - found->second);
+        found->second += change;
+    }
+    total += change;
+    dirty = true;
+}
+
+double JobHistory::Estimate(uint64_t id) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto found = durations.find(id);
+    if (found != durations.end()) {
+        return found->second;
+    }
+    if (durations.empty()) {
+        return 1;
+    }
+    return total / durations.size();
+}
+
+// Run saves the history whenever it has changed within an interval and
+// a last time once the history is stopped. Being the only writer, saves
+// never overtake each other.
+void JobHistory::Run() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!stopping) {
+        cv.wait_for(lock, SAVE_INTERVAL, [this]() { return stopping; });
+        if (!dirty) {
+            continue;
+        }
+        dirty = false;
+        std::ostringstream data;
+        for (auto const& entry : durations) {
+            data << entry.first << " " << (long long)entry.second << "\n";
+        }
+        lock.unlock();
+        Save(data.str());
+        lock.lock();
+    }
+}
+
+// Save replaces the history file, so readers never see half of it.
+void JobHistory::Save(const std::string& data) {
+    std::string temp_path = path + ".tmp";
+    {
+        std::ofstream file(temp_path.c_str(), std::ios::out | std::ios::trunc);
+        if (!file.is_open() || !file.write(data.data(), data.size()).good()) {
+            return;
+        }
+    }
+    std::rename(temp_path.c_str(), path.c_str());
+}
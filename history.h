@@ -0,0 +1,49 @@
+#ifndef HISTORY_H
+#define HISTORY_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+// JobHistory keeps a moving average of the wall clock duration of every
+// job. With a path set it is loaded from and saved to a small text file,
+// one "<64 bit job id> <microseconds>" line per job, so estimates survive the
+// plugin process. Record only updates memory. A writer thread saves changes
+// periodically and once more when the history is destroyed. Safe for
+// concurrent use.
+class JobHistory {
+    public:
+        ~JobHistory();
+
+        // Load reads the history file at path and starts saving to it. A
+        // missing or broken file starts an empty history. Must be called
+        // at most once.
+        void Load(const std::string& path);
+
+        // Record adds a measured duration of the given job.
+        void Record(uint64_t id, std::chrono::microseconds duration);
+
+        // Estimate returns the expected duration of the given job. Jobs
+        // without history are expected to take the average of all jobs.
+        double Estimate(uint64_t id) const;
+
+    private:
+        mutable std::mutex mutex;
+        std::unordered_map<uint64_t, double> durations;
+        // Sum of all durations, for the average of jobs without history.
+        double total = 0;
+        std::string path;
+        bool dirty = false;
+        bool stopping = false;
+        std::condition_variable cv;
+        std::thread writer;
+
+        void Run();
+        void Save(const std::string& data);
+};
+
+#endif
@@ -0,0 +1,115 @@
+#include <algorithm>
+#include <climits>
+#include "job_semaphores.h"
+
+// Slots of the semaphore shared by all jobs. An exclusive job takes all
+// of them, every other job one.
+static const int EXCLUSIVE_SLOTS = INT_MAX;
+
+JobSemaphores::JobSemaphores(const std::vector<gaia::job_wrapper>& jobs, const std::map<std::string, int>& capacities) GAIA_THROWS
+    : units(jobs.size()), waiting(mutex) {
+    std::map<std::string, size_t> resources;
+    for (auto const& capacity : capacities) {
+        if (capacity.second < 1) {
+            throw "resource '" + capacity.first + "' needs at least one slot";
+        }
+    }
+
+    // The shared semaphore only exists if there is an exclusive job.
+    bool exclusive = false;
+    for (auto const& job : jobs) {
+        exclusive = exclusive || job.concurrency.exclusive;
+    }
+    if (exclusive) {
+        available.push_back(EXCLUSIVE_SLOTS);
+    }
+
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        const gaia::concurrency_policy& policy = jobs[i].concurrency;
+        if (exclusive) {
+            units[i].push_back(std::make_pair(0, policy.exclusive ? EXCLUSIVE_SLOTS : 1));
+        }
+        if (policy.max_concurrent < 0) {
+            throw "job '" + jobs[i].job.title() + "' has a negative concurrency limit";
+        } else if (policy.max_concurrent > 0) {
+            units[i].push_back(std::make_pair(available.size(), 1));
+            available.push_back(policy.max_concurrent);
+        }
+        for (auto const& name : policy.resources) {
+            if (name.empty()) {
+                throw "job '" + jobs[i].job.title() + "' uses a resource without name";
+            }
+            auto found = resources.find(name);
+            if (found == resources.end()) {
+                auto capacity = capacities.find(name);
+                found = resources.emplace(name, available.size()).first;
+                available.push_back(capacity == capacities.end() ? 1 : capacity->second);
+            }
+            units[i].push_back(std::make_pair(found->second, 1));
+        }
+
+        // A resource listed twice is held once.
+        std::sort(units[i].begin(), units[i].end());
+        units[i].erase(std::unique(units[i].begin(), units[i].end()), units[i].end());
+    }
+}
+
+void JobSemaphores::Acquire(size_t job, const gaia::cancellation_token& token, std::function<void()> start, std::function<void()> cancelled) {
+    unsigned long waiter;
+    std::vector<WaitQueue::Waiter> ready;
+    bool granted;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        waiter = waiting.Push(token, std::move(start), job);
+        Grant(ready);
+        granted = !waiting.Contains(waiter);
+    }
+    WaitQueue::Start(ready);
+    if (granted) {
+        return;
+    }
+
+    // The cancelled job may have held back others.
+    waiting.Watch(waiter, cancelled, [this](std::vector<WaitQueue::Waiter>& ready) {
+        Grant(ready);
+    });
+}
+
+void JobSemaphores::Release(size_t job) {
+    std::vector<WaitQueue::Waiter> ready;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto const& unit : units[job]) {
+            available[unit.first] += unit.second;
+        }
+        Grant(ready);
+    }
+    WaitQueue::Start(ready);
+}
+
+void JobSemaphores::Grant(std::vector<WaitQueue::Waiter>& ready) {
+    std::vector<bool> held_back(available.size(), false);
+    for (auto it = waiting.begin(); it != waiting.end();) {
+        const std::vector<std::pair<size_t, int>>& needed = units[it->second.job];
+        bool fits = true;
+        for (auto const& unit : needed) {
+            fits = fits && !held_back[unit.first] && available[unit.first] >= unit.second;
+        }
+        if (!fits) {
+            // Only the semaphores it lacks are reserved for it, so a job
+            // waiting for a resource does not block jobs which share
+            // nothing else with it.
+            for (auto const& unit : needed) {
+                if (available[unit.first] < unit.second) {
+                    held_back[unit.first] = true;
+                }
+            }
+            ++it;
+            continue;
+        }
+        for (auto const& unit : needed) {
+            available[unit.first] -= unit.second;
+        }
+        it = waiting.Take(it, ready);
+    }
+}
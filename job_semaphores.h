@@ -0,0 +1,54 @@
+#ifndef JOB_SEMAPHORES_H
+#define JOB_SEMAPHORES_H
+
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+#include "sdk.h"
+#include "wait_queue.h"
+
+// JobSemaphores enforces the concurrency policies of the jobs with
+// counting semaphores: one per job with limited executions, one per named
+// resource and one shared by all jobs, which exclusive jobs take as a
+// whole. An execution takes all its semaphores at once or waits without
+// holding any, so jobs never deadlock, and waits without a thread.
+// Waiting executions are granted in arrival order. One which does not fit
+// holds back later ones that need a semaphore it is short of, so
+// exclusive jobs do not starve. Safe for concurrent use.
+class JobSemaphores {
+    public:
+        // jobs are the jobs of the registry, capacities the slots of named
+        // resources. Throws on an invalid policy.
+        JobSemaphores(const std::vector<gaia::job_wrapper>& jobs, const std::map<std::string, int>& capacities) GAIA_THROWS;
+
+        // Needed returns true if the job at the given registry position
+        // has to acquire semaphores before it runs.
+        bool Needed(size_t job) const {
+            return !units[job].empty();
+        }
+
+        // Acquire calls start once the job holds all its semaphores, right
+        // away if they are free. If the token fires while the job waits,
+        // cancelled is called instead.
+        void Acquire(size_t job, const gaia::cancellation_token& token, std::function<void()> start, std::function<void()> cancelled);
+
+        // Release returns the semaphores of a started job and starts the
+        // waiting jobs which fit now.
+        void Release(size_t job);
+
+    private:
+        // Slots every job takes, as semaphore index and count.
+        std::vector<std::vector<std::pair<size_t, int>>> units;
+        std::vector<int> available;
+        std::mutex mutex;
+        WaitQueue waiting;
+
+        // Grant moves the waiters which fit to ready and takes their
+        // slots. Called with the lock held.
+        void Grant(std::vector<WaitQueue::Waiter>& ready);
+};
+
+#endif
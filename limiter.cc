@@ -0,0 +1,71 @@
+#include <algorithm>
+#include "limiter.h"
+
+// Weight of a new measurement in the smoothed latency ratio.
+static const double SMOOTHING = 0.2;
+
+// Jobs may take this much longer than their baseline before the limit
+// shrinks. Covers the usual variance of build jobs.
+static const double TOLERANCE = 1.5;
+
+// A single sample shrinks the limit at most by half.
+static const double MIN_GRADIENT = 0.5;
+
+// Baselines grow by this factor per sample, so a single unusually fast
+// run does not hold the limit down forever.
+static const double BASELINE_DRIFT = 1.01;
+
+ConcurrencyLimiter::ConcurrencyLimiter(int initial, int min_limit, int max_limit, std::function<void(int)> changed)
+    : min_limit(min_limit), max_limit(max_limit), changed(changed), limit(initial), ratio(1) {
+    limit = std::max<double>(min_limit, std::min<double>(max_limit, limit));
+    published = (int)limit;
+}
+
+void ConcurrencyLimiter::Record(uint64_t id, double latency) {
+    if (latency <= 0) {
+        return;
+    }
+    int before;
+    int after;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        double& baseline = baselines[id];
+        baseline = baseline == 0 ? latency : std::min(latency, baseline * BASELINE_DRIFT);
+        ratio += SMOOTHING * (latency / baseline - ratio);
+
+        // Shrink by the smoothed gradient while jobs are slow, otherwise
+        // grow by one every limit samples.
+        before = (int)limit;
+        if (ratio > TOLERANCE) {
+            double gradient = std::max(MIN_GRADIENT, TOLERANCE / ratio);
+            limit += SMOOTHING * (limit * gradient - limit);
+        } else {
+            limit += 1 / limit;
+        }
+        limit = std::max<double>(min_limit, std::min<double>(max_limit, limit));
+        after = (int)limit;
+    }
+    if (after != before) {
+        Publish();
+    }
+}
+
+void ConcurrencyLimiter::Publish() {
+    // Concurrent changes are published in order, the last one wins.
+    std::lock_guard<std::mutex> lock(publish_mutex);
+    int current = Limit();
+    if (current != published) {
+        published = current;
+        changed(current);
+    }
+}
+
+int ConcurrencyLimiter::Limit() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return (int)limit;
+}
+
+double ConcurrencyLimiter::Ratio() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return ratio;
+}
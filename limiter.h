@@ -0,0 +1,48 @@
+#ifndef LIMITER_H
+#define LIMITER_H
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+
+// ConcurrencyLimiter adapts the number of jobs which may run at the same
+// time to the observed job latency, in the manner of a gradient limiter.
+// Every job is compared to the fastest recent execution of the same job.
+// While jobs finish within the tolerance the limit slowly grows, once
+// they slow down it shrinks by the ratio of the two. Safe for concurrent
+// use.
+class ConcurrencyLimiter {
+    public:
+        // changed is called with the new limit whenever its integral part
+        // changes. Calls are serialized and never hold the limit lock.
+        ConcurrencyLimiter(int initial, int min_limit, int max_limit, std::function<void(int)> changed);
+
+        // Record adds the latency of a finished job in microseconds.
+        void Record(uint64_t id, double latency);
+
+        // Limit returns the current limit.
+        int Limit() const;
+
+        // Ratio returns the smoothed ratio of observed to baseline latency.
+        double Ratio() const;
+
+        int MinLimit() const {
+            return min_limit;
+        }
+
+    private:
+        const int min_limit;
+        const int max_limit;
+        std::function<void(int)> changed;
+        mutable std::mutex mutex;
+        double limit;
+        double ratio;
+        std::unordered_map<uint64_t, double> baselines;
+        std::mutex publish_mutex;
+        int published;
+
+        void Publish();
+};
+
+#endif
@@ -0,0 +1,105 @@
+#include <algorithm>
+#include <cstring>
+#include "logbuffer.h"
+
+// Longest time a side waits before it checks the ring again. Only a
+// safety net, both sides notify each other.
+static const std::chrono::milliseconds MAX_WAIT(10);
+
+LogBuffer::LogBuffer(size_t capacity)
+    : head(0), tail(0), write_closed(false), closed(false), writer_waiting(false), reader_waiting(false) {
+    size_t size = 1;
+    while (size < capacity) {
+        size <<= 1;
+    }
+    ring.reset(new char[size]);
+    mask = size - 1;
+}
+
+bool LogBuffer::Write(const char* data, size_t size) {
+    const size_t capacity = mask + 1;
+    size_t position = tail.load(std::memory_order_relaxed);
+    while (size > 0) {
+        if (closed.load()) {
+            return false;
+        }
+
+        // Wait for the reader if the ring is full.
+        size_t free = capacity - (position - head.load());
+        if (free == 0) {
+            Wait(writer_waiting, [this, position, capacity]() {
+                return closed.load() || position - head.load() < capacity;
+            }, MAX_WAIT);
+            continue;
+        }
+
+        // Copy as much as fits, wrapping around the end of the ring.
+        size_t count = std::min(size, free);
+        size_t offset = position & mask;
+        size_t first = std::min(count, capacity - offset);
+        std::memcpy(ring.get() + offset, data, first);
+        std::memcpy(ring.get(), data + first, count - first);
+        position += count;
+        tail.store(position);
+        Notify(reader_waiting);
+
+        data += count;
+        size -= count;
+    }
+    return true;
+}
+
+size_t LogBuffer::Read(char* data, size_t size, std::chrono::milliseconds timeout) {
+    const size_t capacity = mask + 1;
+    size_t position = head.load(std::memory_order_relaxed);
+    size_t available = tail.load() - position;
+    if (available == 0) {
+        Wait(reader_waiting, [this, position]() {
+            return write_closed.load() || tail.load() != position;
+        }, timeout);
+        available = tail.load() - position;
+        if (available == 0) {
+            return 0;
+        }
+    }
+
+    size_t count = std::min(size, available);
+    size_t offset = position & mask;
+    size_t first = std::min(count, capacity - offset);
+    std::memcpy(data, ring.get() + offset, first);
+    std::memcpy(data + first, ring.get(), count - first);
+    head.store(position + count);
+    Notify(writer_waiting);
+    return count;
+}
+
+void LogBuffer::CloseWrite() {
+    write_closed = true;
+    Notify(reader_waiting);
+}
+
+void LogBuffer::Close() {
+    closed = true;
+    Notify(writer_waiting);
+}
+
+bool LogBuffer::Drained() const {
+    return write_closed.load() && tail.load() == head.load();
+}
+
+// Wait blocks until ready returns true or the timeout has passed. The
+// waiting flag tells the other side to notify, so the fast path of both
+// sides never takes the mutex.
+void LogBuffer::Wait(std::atomic<bool>& waiting, std::function<bool()> ready, std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(mutex);
+    waiting = true;
+    cv.wait_for(lock, std::min(timeout, MAX_WAIT), ready);
+    waiting = false;
+}
+
+void LogBuffer::Notify(const std::atomic<bool>& waiting) {
+    if (waiting.load()) {
+        std::lock_guard<std::mutex> lock(mutex);
+        cv.notify_all();
+    }
+}
@@ -0,0 +1,63 @@
+#ifndef LOGBUFFER_H
+#define LOGBUFFER_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+// LogBuffer is a bounded single producer, single consumer byte ring
+// which carries the log output of a streamed job to its rpc. The job
+// writes and the transport thread reads. Both sides only touch atomics
+// unless the ring is full or empty and they have to wait for each other,
+// so a full ring slows the job down instead of growing memory.
+class LogBuffer {
+    public:
+        // The capacity is rounded up to the next power of two.
+        explicit LogBuffer(size_t capacity);
+
+        // Write appends the given data and blocks while the ring is full.
+        // Returns false once the reader has closed the buffer.
+        bool Write(const char* data, size_t size);
+
+        // Read moves up to size bytes into data. It waits at most timeout
+        // for data and returns the number of bytes read.
+        size_t Read(char* data, size_t size, std::chrono::milliseconds timeout);
+
+        // CloseWrite marks the end of the output. Called by the writer.
+        void CloseWrite();
+
+        // Close drops the output. Pending and later writes return false.
+        void Close();
+
+        // Drained returns true once the writer is done and all data has
+        // been read.
+        bool Drained() const;
+
+    private:
+        std::unique_ptr<char[]> ring;
+        size_t mask;
+
+        // Both positions only grow. head is advanced by the reader, tail
+        // by the writer. They live on their own cache lines.
+        char head_padding[64];
+        std::atomic<size_t> head;
+        char tail_padding[64];
+        std::atomic<size_t> tail;
+        char flags_padding[64];
+
+        std::atomic<bool> write_closed;
+        std::atomic<bool> closed;
+        std::atomic<bool> writer_waiting;
+        std::atomic<bool> reader_waiting;
+        std::mutex mutex;
+        std::condition_variable cv;
+
+        void Wait(std::atomic<bool>& waiting, std::function<bool()> ready, std::chrono::milliseconds timeout);
+        void Notify(const std::atomic<bool>& waiting);
+};
+
+#endif
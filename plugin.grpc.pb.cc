@@ -6,79 +6,153 @@
 #include "plugin.grpc.pb.h"
 
 #include <functional>
-#include <grpcpp/impl/codegen/async_stream.h>
-#include <grpcpp/impl/codegen/async_unary_call.h>
-#include <grpcpp/impl/codegen/channel_interface.h>
-#include <grpcpp/impl/codegen/client_unary_call.h>
-#include <grpcpp/impl/codegen/client_callback.h>
-#include <grpcpp/impl/codegen/message_allocator.h>
-#include <grpcpp/impl/codegen/method_handler.h>
-#include <grpcpp/impl/codegen/rpc_service_method.h>
-#include <grpcpp/impl/codegen/server_callback.h>
+#include <grpcpp/support/async_stream.h>
+#include <grpcpp/support/async_unary_call.h>
+#include <grpcpp/impl/channel_interface.h>
+#include <grpcpp/impl/client_unary_call.h>
+#include <grpcpp/support/client_callback.h>
+#include <grpcpp/support/message_allocator.h>
+#include <grpcpp/support/method_handler.h>
+#include <grpcpp/impl/rpc_service_method.h>
+#include <grpcpp/support/server_callback.h>
 #include <grpcpp/impl/codegen/server_callback_handlers.h>
-#include <grpcpp/impl/codegen/server_context.h>
-#include <grpcpp/impl/codegen/service_type.h>
-#include <grpcpp/impl/codegen/sync_stream.h>
+#include <grpcpp/server_context.h>
+#include <grpcpp/impl/service_type.h>
+#include <grpcpp/support/sync_stream.h>
 namespace proto {
 
 static const char* Plugin_method_names[] = {
   "/proto.Plugin/GetJobs",
   "/proto.Plugin/ExecuteJob",
+  "/proto.Plugin/Execute",
+  "/proto.Plugin/ExecuteJobStream",
+  "/proto.Plugin/ExecuteJobs",
+  "/proto.Plugin/Session",
 };
 
 std::unique_ptr< Plugin::Stub> Plugin::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
   (void)options;
-  std::unique_ptr< Plugin::Stub> stub(new Plugin::Stub(channel));
+  std::unique_ptr< Plugin::Stub> stub(new Plugin::Stub(channel, options));
   return stub;
 }
 
-Plugin::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel)
-  : channel_(channel), rpcmethod_GetJobs_(Plugin_method_names[0], ::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
-  , rpcmethod_ExecuteJob_(Plugin_method_names[1], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+Plugin::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options)
+  : channel_(channel), rpcmethod_GetJobs_(Plugin_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  , rpcmethod_ExecuteJob_(Plugin_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_Execute_(Plugin_method_names[2], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_ExecuteJobStream_(Plugin_method_names[3], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  , rpcmethod_ExecuteJobs_(Plugin_method_names[4], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  , rpcmethod_Session_(Plugin_method_names[5], options.suffix_for_stats(),::grpc::internal::RpcMethod::BIDI_STREAMING, channel)
   {}
 
 ::grpc::ClientReader< ::proto::Job>* Plugin::Stub::GetJobsRaw(::grpc::ClientContext* context, const ::proto::Empty& request) {
-  return ::grpc_impl::internal::ClientReaderFactory< ::proto::Job>::Create(channel_.get(), rpcmethod_GetJobs_, context, request);
+  return ::grpc::internal::ClientReaderFactory< ::proto::Job>::Create(channel_.get(), rpcmethod_GetJobs_, context, request);
 }
 
-void Plugin::Stub::experimental_async::GetJobs(::grpc::ClientContext* context, ::proto::Empty* request, ::grpc::experimental::ClientReadReactor< ::proto::Job>* reactor) {
-  ::grpc_impl::internal::ClientCallbackReaderFactory< ::proto::Job>::Create(stub_->channel_.get(), stub_->rpcmethod_GetJobs_, context, request, reactor);
+void Plugin::Stub::async::GetJobs(::grpc::ClientContext* context, const ::proto::Empty* request, ::grpc::ClientReadReactor< ::proto::Job>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::proto::Job>::Create(stub_->channel_.get(), stub_->rpcmethod_GetJobs_, context, request, reactor);
 }
 
 ::grpc::ClientAsyncReader< ::proto::Job>* Plugin::Stub::AsyncGetJobsRaw(::grpc::ClientContext* context, const ::proto::Empty& request, ::grpc::CompletionQueue* cq, void* tag) {
-  return ::grpc_impl::internal::ClientAsyncReaderFactory< ::proto::Job>::Create(channel_.get(), cq, rpcmethod_GetJobs_, context, request, true, tag);
+  return ::grpc::internal::ClientAsyncReaderFactory< ::proto::Job>::Create(channel_.get(), cq, rpcmethod_GetJobs_, context, request, true, tag);
 }
 
 ::grpc::ClientAsyncReader< ::proto::Job>* Plugin::Stub::PrepareAsyncGetJobsRaw(::grpc::ClientContext* context, const ::proto::Empty& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc_impl::internal::ClientAsyncReaderFactory< ::proto::Job>::Create(channel_.get(), cq, rpcmethod_GetJobs_, context, request, false, nullptr);
+  return ::grpc::internal::ClientAsyncReaderFactory< ::proto::Job>::Create(channel_.get(), cq, rpcmethod_GetJobs_, context, request, false, nullptr);
 }
 
 ::grpc::Status Plugin::Stub::ExecuteJob(::grpc::ClientContext* context, const ::proto::Job& request, ::proto::JobResult* response) {
-  return ::grpc::internal::BlockingUnaryCall(channel_.get(), rpcmethod_ExecuteJob_, context, request, response);
+  return ::grpc::internal::BlockingUnaryCall< ::proto::Job, ::proto::JobResult, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_ExecuteJob_, context, request, response);
 }
 
-void Plugin::Stub::experimental_async::ExecuteJob(::grpc::ClientContext* context, const ::proto::Job* request, ::proto::JobResult* response, std::function<void(::grpc::Status)> f) {
-  ::grpc_impl::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_ExecuteJob_, context, request, response, std::move(f));
+void Plugin::Stub::async::ExecuteJob(::grpc::ClientContext* context, const ::proto::Job* request, ::proto::JobResult* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::proto::Job, ::proto::JobResult, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ExecuteJob_, context, request, response, std::move(f));
 }
 
-void Plugin::Stub::experimental_async::ExecuteJob(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::proto::JobResult* response, std::function<void(::grpc::Status)> f) {
-  ::grpc_impl::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_ExecuteJob_, context, request, response, std::move(f));
+void Plugin::Stub::async::ExecuteJob(::grpc::ClientContext* context, const ::proto::Job* request, ::proto::JobResult* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ExecuteJob_, context, request, response, reactor);
 }
 
-void Plugin::Stub::experimental_async::ExecuteJob(::grpc::ClientContext* context, const ::proto::Job* request, ::proto::JobResult* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
-  ::grpc_impl::internal::ClientCallbackUnaryFactory::Create(stub_->channel_.get(), stub_->rpcmethod_ExecuteJob_, context, request, response, reactor);
+::grpc::ClientAsyncResponseReader< ::proto::JobResult>* Plugin::Stub::PrepareAsyncExecuteJobRaw(::grpc::ClientContext* context, const ::proto::Job& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::proto::JobResult, ::proto::Job, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_ExecuteJob_, context, request);
 }
 
-void Plugin::Stub::experimental_async::ExecuteJob(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::proto::JobResult* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
-  ::grpc_impl::internal::ClientCallbackUnaryFactory::Create(stub_->channel_.get(), stub_->rpcmethod_ExecuteJob_, context, request, response, reactor);
+::grpc::ClientAsyncResponseReader< ::proto::JobResult>* Plugin::Stub::AsyncExecuteJobRaw(::grpc::ClientContext* context, const ::proto::Job& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncExecuteJobRaw(context, request, cq);
+  result->StartCall();
+  return result;
 }
 
-::grpc::ClientAsyncResponseReader< ::proto::JobResult>* Plugin::Stub::AsyncExecuteJobRaw(::grpc::ClientContext* context, const ::proto::Job& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc_impl::internal::ClientAsyncResponseReaderFactory< ::proto::JobResult>::Create(channel_.get(), cq, rpcmethod_ExecuteJob_, context, request, true);
+::grpc::Status Plugin::Stub::Execute(::grpc::ClientContext* context, const ::proto::ExecuteRequest& request, ::proto::JobResult* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::proto::ExecuteRequest, ::proto::JobResult, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_Execute_, context, request, response);
 }
 
-::grpc::ClientAsyncResponseReader< ::proto::JobResult>* Plugin::Stub::PrepareAsyncExecuteJobRaw(::grpc::ClientContext* context, const ::proto::Job& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc_impl::internal::ClientAsyncResponseReaderFactory< ::proto::JobResult>::Create(channel_.get(), cq, rpcmethod_ExecuteJob_, context, request, false);
+void Plugin::Stub::async::Execute(::grpc::ClientContext* context, const ::proto::ExecuteRequest* request, ::proto::JobResult* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::proto::ExecuteRequest, ::proto::JobResult, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Execute_, context, request, response, std::move(f));
+}
+
+void Plugin::Stub::async::Execute(::grpc::ClientContext* context, const ::proto::ExecuteRequest* request, ::proto::JobResult* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Execute_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::proto::JobResult>* Plugin::Stub::PrepareAsyncExecuteRaw(::grpc::ClientContext* context, const ::proto::ExecuteRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::proto::JobResult, ::proto::ExecuteRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_Execute_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::proto::JobResult>* Plugin::Stub::AsyncExecuteRaw(::grpc::ClientContext* context, const ::proto::ExecuteRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncExecuteRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::ClientReader< ::proto::JobOutput>* Plugin::Stub::ExecuteJobStreamRaw(::grpc::ClientContext* context, const ::proto::Job& request) {
+  return ::grpc::internal::ClientReaderFactory< ::proto::JobOutput>::Create(channel_.get(), rpcmethod_ExecuteJobStream_, context, request);
+}
+
+void Plugin::Stub::async::ExecuteJobStream(::grpc::ClientContext* context, const ::proto::Job* request, ::grpc::ClientReadReactor< ::proto::JobOutput>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::proto::JobOutput>::Create(stub_->channel_.get(), stub_->rpcmethod_ExecuteJobStream_, context, request, reactor);
+}
+
+::grpc::ClientAsyncReader< ::proto::JobOutput>* Plugin::Stub::AsyncExecuteJobStreamRaw(::grpc::ClientContext* context, const ::proto::Job& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::proto::JobOutput>::Create(channel_.get(), cq, rpcmethod_ExecuteJobStream_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::proto::JobOutput>* Plugin::Stub::PrepareAsyncExecuteJobStreamRaw(::grpc::ClientContext* context, const ::proto::Job& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::proto::JobOutput>::Create(channel_.get(), cq, rpcmethod_ExecuteJobStream_, context, request, false, nullptr);
+}
+
+::grpc::ClientReader< ::proto::JobResult>* Plugin::Stub::ExecuteJobsRaw(::grpc::ClientContext* context, const ::proto::JobBatch& request) {
+  return ::grpc::internal::ClientReaderFactory< ::proto::JobResult>::Create(channel_.get(), rpcmethod_ExecuteJobs_, context, request);
+}
+
+void Plugin::Stub::async::ExecuteJobs(::grpc::ClientContext* context, const ::proto::JobBatch* request, ::grpc::ClientReadReactor< ::proto::JobResult>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::proto::JobResult>::Create(stub_->channel_.get(), stub_->rpcmethod_ExecuteJobs_, context, request, reactor);
+}
+
+::grpc::ClientAsyncReader< ::proto::JobResult>* Plugin::Stub::AsyncExecuteJobsRaw(::grpc::ClientContext* context, const ::proto::JobBatch& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::proto::JobResult>::Create(channel_.get(), cq, rpcmethod_ExecuteJobs_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::proto::JobResult>* Plugin::Stub::PrepareAsyncExecuteJobsRaw(::grpc::ClientContext* context, const ::proto::JobBatch& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::proto::JobResult>::Create(channel_.get(), cq, rpcmethod_ExecuteJobs_, context, request, false, nullptr);
+}
+
+::grpc::ClientReaderWriter< ::proto::SessionRequest, ::proto::SessionResult>* Plugin::Stub::SessionRaw(::grpc::ClientContext* context) {
+  return ::grpc::internal::ClientReaderWriterFactory< ::proto::SessionRequest, ::proto::SessionResult>::Create(channel_.get(), rpcmethod_Session_, context);
+}
+
+void Plugin::Stub::async::Session(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::proto::SessionRequest,::proto::SessionResult>* reactor) {
+  ::grpc::internal::ClientCallbackReaderWriterFactory< ::proto::SessionRequest,::proto::SessionResult>::Create(stub_->channel_.get(), stub_->rpcmethod_Session_, context, reactor);
+}
+
+::grpc::ClientAsyncReaderWriter< ::proto::SessionRequest, ::proto::SessionResult>* Plugin::Stub::AsyncSessionRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::proto::SessionRequest, ::proto::SessionResult>::Create(channel_.get(), cq, rpcmethod_Session_, context, true, tag);
+}
+
+::grpc::ClientAsyncReaderWriter< ::proto::SessionRequest, ::proto::SessionResult>* Plugin::Stub::PrepareAsyncSessionRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::proto::SessionRequest, ::proto::SessionResult>::Create(channel_.get(), cq, rpcmethod_Session_, context, false, nullptr);
 }
 
 Plugin::Service::Service() {
@@ -87,21 +161,61 @@ Plugin::Service::Service() {
       ::grpc::internal::RpcMethod::SERVER_STREAMING,
       new ::grpc::internal::ServerStreamingHandler< Plugin::Service, ::proto::Empty, ::proto::Job>(
           [](Plugin::Service* service,
-             ::grpc_impl::ServerContext* ctx,
+             ::grpc::ServerContext* ctx,
              const ::proto::Empty* req,
-             ::grpc_impl::ServerWriter<::proto::Job>* writer) {
+             ::grpc::ServerWriter<::proto::Job>* writer) {
                return service->GetJobs(ctx, req, writer);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       Plugin_method_names[1],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< Plugin::Service, ::proto::Job, ::proto::JobResult>(
+      new ::grpc::internal::RpcMethodHandler< Plugin::Service, ::proto::Job, ::proto::JobResult, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](Plugin::Service* service,
-             ::grpc_impl::ServerContext* ctx,
+             ::grpc::ServerContext* ctx,
              const ::proto::Job* req,
              ::proto::JobResult* resp) {
                return service->ExecuteJob(ctx, req, resp);
              }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      Plugin_method_names[2],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< Plugin::Service, ::proto::ExecuteRequest, ::proto::JobResult, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](Plugin::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::proto::ExecuteRequest* req,
+             ::proto::JobResult* resp) {
+               return service->Execute(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      Plugin_method_names[3],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< Plugin::Service, ::proto::Job, ::proto::JobOutput>(
+          [](Plugin::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::proto::Job* req,
+             ::grpc::ServerWriter<::proto::JobOutput>* writer) {
+               return service->ExecuteJobStream(ctx, req, writer);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      Plugin_method_names[4],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< Plugin::Service, ::proto::JobBatch, ::proto::JobResult>(
+          [](Plugin::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::proto::JobBatch* req,
+             ::grpc::ServerWriter<::proto::JobResult>* writer) {
+               return service->ExecuteJobs(ctx, req, writer);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      Plugin_method_names[5],
+      ::grpc::internal::RpcMethod::BIDI_STREAMING,
+      new ::grpc::internal::BidiStreamingHandler< Plugin::Service, ::proto::SessionRequest, ::proto::SessionResult>(
+          [](Plugin::Service* service,
+             ::grpc::ServerContext* ctx,
+             ::grpc::ServerReaderWriter<::proto::SessionResult,
+             ::proto::SessionRequest>* stream) {
+               return service->Session(ctx, stream);
+             }, this)));
 }
 
 Plugin::Service::~Service() {
@@ -121,6 +235,33 @@ Plugin::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status Plugin::Service::Execute(::grpc::ServerContext* context, const ::proto::ExecuteRequest* request, ::proto::JobResult* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status Plugin::Service::ExecuteJobStream(::grpc::ServerContext* context, const ::proto::Job* request, ::grpc::ServerWriter< ::proto::JobOutput>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status Plugin::Service::ExecuteJobs(::grpc::ServerContext* context, const ::proto::JobBatch* request, ::grpc::ServerWriter< ::proto::JobResult>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status Plugin::Service::Session(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::proto::SessionResult, ::proto::SessionRequest>* stream) {
+  (void) context;
+  (void) stream;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 }  // namespace proto
 
@@ -13,24 +13,23 @@
 #include "plugin.pb.h"
 
 #include <functional>
-#include <grpc/impl/codegen/port_platform.h>
-#include <grpcpp/impl/codegen/async_generic_service.h>
-#include <grpcpp/impl/codegen/async_stream.h>
-#include <grpcpp/impl/codegen/async_unary_call.h>
-#include <grpcpp/impl/codegen/client_callback.h>
-#include <grpcpp/impl/codegen/client_context.h>
-#include <grpcpp/impl/codegen/completion_queue.h>
-#include <grpcpp/impl/codegen/message_allocator.h>
-#include <grpcpp/impl/codegen/method_handler.h>
+#include <grpcpp/generic/async_generic_service.h>
+#include <grpcpp/support/async_stream.h>
+#include <grpcpp/support/async_unary_call.h>
+#include <grpcpp/support/client_callback.h>
+#include <grpcpp/client_context.h>
+#include <grpcpp/completion_queue.h>
+#include <grpcpp/support/message_allocator.h>
+#include <grpcpp/support/method_handler.h>
 #include <grpcpp/impl/codegen/proto_utils.h>
-#include <grpcpp/impl/codegen/rpc_method.h>
-#include <grpcpp/impl/codegen/server_callback.h>
+#include <grpcpp/impl/rpc_method.h>
+#include <grpcpp/support/server_callback.h>
 #include <grpcpp/impl/codegen/server_callback_handlers.h>
-#include <grpcpp/impl/codegen/server_context.h>
-#include <grpcpp/impl/codegen/service_type.h>
+#include <grpcpp/server_context.h>
+#include <grpcpp/impl/service_type.h>
 #include <grpcpp/impl/codegen/status.h>
-#include <grpcpp/impl/codegen/stub_options.h>
-#include <grpcpp/impl/codegen/sync_stream.h>
+#include <grpcpp/support/stub_options.h>
+#include <grpcpp/support/sync_stream.h>
 
 namespace proto {
 
@@ -62,48 +61,108 @@ class Plugin final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::proto::JobResult>> PrepareAsyncExecuteJob(::grpc::ClientContext* context, const ::proto::Job& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::proto::JobResult>>(PrepareAsyncExecuteJobRaw(context, request, cq));
     }
-    class experimental_async_interface {
+    // Execute signals the plugin to execute the given job like
+    // ExecuteJob, without the job fields the plugin does not need.
+    // Available from protocol version 3 on.
+    virtual ::grpc::Status Execute(::grpc::ClientContext* context, const ::proto::ExecuteRequest& request, ::proto::JobResult* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::proto::JobResult>> AsyncExecute(::grpc::ClientContext* context, const ::proto::ExecuteRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::proto::JobResult>>(AsyncExecuteRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::proto::JobResult>> PrepareAsyncExecute(::grpc::ClientContext* context, const ::proto::ExecuteRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::proto::JobResult>>(PrepareAsyncExecuteRaw(context, request, cq));
+    }
+    // ExecuteJobStream signals the plugin to execute the given job.
+    // Streams the log output of the job while it runs and its result
+    // once it has finished.
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::proto::JobOutput>> ExecuteJobStream(::grpc::ClientContext* context, const ::proto::Job& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< ::proto::JobOutput>>(ExecuteJobStreamRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::proto::JobOutput>> AsyncExecuteJobStream(::grpc::ClientContext* context, const ::proto::Job& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::proto::JobOutput>>(AsyncExecuteJobStreamRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::proto::JobOutput>> PrepareAsyncExecuteJobStream(::grpc::ClientContext* context, const ::proto::Job& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::proto::JobOutput>>(PrepareAsyncExecuteJobStreamRaw(context, request, cq));
+    }
+    // ExecuteJobs signals the plugin to execute the given jobs in
+    // dependency order. Independent jobs run in parallel. Returns the
+    // result of every job once it has finished. No further jobs are
+    // started after a job failed, they get a failed result at the end.
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::proto::JobResult>> ExecuteJobs(::grpc::ClientContext* context, const ::proto::JobBatch& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< ::proto::JobResult>>(ExecuteJobsRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::proto::JobResult>> AsyncExecuteJobs(::grpc::ClientContext* context, const ::proto::JobBatch& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::proto::JobResult>>(AsyncExecuteJobsRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::proto::JobResult>> PrepareAsyncExecuteJobs(::grpc::ClientContext* context, const ::proto::JobBatch& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::proto::JobResult>>(PrepareAsyncExecuteJobsRaw(context, request, cq));
+    }
+    // Session executes the jobs Gaia sends over a single long-lived
+    // stream. Every result is sent once its job has finished, so results
+    // may arrive out of order and are matched by correlation id.
+    // Available from protocol version 3 on.
+    std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::proto::SessionRequest, ::proto::SessionResult>> Session(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::proto::SessionRequest, ::proto::SessionResult>>(SessionRaw(context));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::proto::SessionRequest, ::proto::SessionResult>> AsyncSession(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::proto::SessionRequest, ::proto::SessionResult>>(AsyncSessionRaw(context, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::proto::SessionRequest, ::proto::SessionResult>> PrepareAsyncSession(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::proto::SessionRequest, ::proto::SessionResult>>(PrepareAsyncSessionRaw(context, cq));
+    }
+    class async_interface {
      public:
-      virtual ~experimental_async_interface() {}
+      virtual ~async_interface() {}
       // GetJobs returns a stream of Job objects.
       // Used to expose jobs to gaia.
-      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-      virtual void GetJobs(::grpc::ClientContext* context, ::proto::Empty* request, ::grpc::ClientReadReactor< ::proto::Job>* reactor) = 0;
-      #else
-      virtual void GetJobs(::grpc::ClientContext* context, ::proto::Empty* request, ::grpc::experimental::ClientReadReactor< ::proto::Job>* reactor) = 0;
-      #endif
+      virtual void GetJobs(::grpc::ClientContext* context, const ::proto::Empty* request, ::grpc::ClientReadReactor< ::proto::Job>* reactor) = 0;
       // ExecuteJob signals the plugin to execute the given job.
       // Used to execute one job from a pipeline.
       virtual void ExecuteJob(::grpc::ClientContext* context, const ::proto::Job* request, ::proto::JobResult* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void ExecuteJob(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::proto::JobResult* response, std::function<void(::grpc::Status)>) = 0;
-      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
       virtual void ExecuteJob(::grpc::ClientContext* context, const ::proto::Job* request, ::proto::JobResult* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      #else
-      virtual void ExecuteJob(::grpc::ClientContext* context, const ::proto::Job* request, ::proto::JobResult* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
-      #endif
-      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-      virtual void ExecuteJob(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::proto::JobResult* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      #else
-      virtual void ExecuteJob(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::proto::JobResult* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
-      #endif
+      // Execute signals the plugin to execute the given job like
+      // ExecuteJob, without the job fields the plugin does not need.
+      // Available from protocol version 3 on.
+      virtual void Execute(::grpc::ClientContext* context, const ::proto::ExecuteRequest* request, ::proto::JobResult* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void Execute(::grpc::ClientContext* context, const ::proto::ExecuteRequest* request, ::proto::JobResult* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // ExecuteJobStream signals the plugin to execute the given job.
+      // Streams the log output of the job while it runs and its result
+      // once it has finished.
+      virtual void ExecuteJobStream(::grpc::ClientContext* context, const ::proto::Job* request, ::grpc::ClientReadReactor< ::proto::JobOutput>* reactor) = 0;
+      // ExecuteJobs signals the plugin to execute the given jobs in
+      // dependency order. Independent jobs run in parallel. Returns the
+      // result of every job once it has finished. No further jobs are
+      // started after a job failed, they get a failed result at the end.
+      virtual void ExecuteJobs(::grpc::ClientContext* context, const ::proto::JobBatch* request, ::grpc::ClientReadReactor< ::proto::JobResult>* reactor) = 0;
+      // Session executes the jobs Gaia sends over a single long-lived
+      // stream. Every result is sent once its job has finished, so results
+      // may arrive out of order and are matched by correlation id.
+      // Available from protocol version 3 on.
+      virtual void Session(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::proto::SessionRequest,::proto::SessionResult>* reactor) = 0;
     };
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-    typedef class experimental_async_interface async_interface;
-    #endif
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-    async_interface* async() { return experimental_async(); }
-    #endif
-    virtual class experimental_async_interface* experimental_async() { return nullptr; }
-  private:
+    typedef class async_interface experimental_async_interface;
+    virtual class async_interface* async() { return nullptr; }
+    class async_interface* experimental_async() { return async(); }
+   private:
     virtual ::grpc::ClientReaderInterface< ::proto::Job>* GetJobsRaw(::grpc::ClientContext* context, const ::proto::Empty& request) = 0;
     virtual ::grpc::ClientAsyncReaderInterface< ::proto::Job>* AsyncGetJobsRaw(::grpc::ClientContext* context, const ::proto::Empty& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
     virtual ::grpc::ClientAsyncReaderInterface< ::proto::Job>* PrepareAsyncGetJobsRaw(::grpc::ClientContext* context, const ::proto::Empty& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::proto::JobResult>* AsyncExecuteJobRaw(::grpc::ClientContext* context, const ::proto::Job& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::proto::JobResult>* PrepareAsyncExecuteJobRaw(::grpc::ClientContext* context, const ::proto::Job& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::proto::JobResult>* AsyncExecuteRaw(::grpc::ClientContext* context, const ::proto::ExecuteRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::proto::JobResult>* PrepareAsyncExecuteRaw(::grpc::ClientContext* context, const ::proto::ExecuteRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< ::proto::JobOutput>* ExecuteJobStreamRaw(::grpc::ClientContext* context, const ::proto::Job& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::proto::JobOutput>* AsyncExecuteJobStreamRaw(::grpc::ClientContext* context, const ::proto::Job& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::proto::JobOutput>* PrepareAsyncExecuteJobStreamRaw(::grpc::ClientContext* context, const ::proto::Job& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< ::proto::JobResult>* ExecuteJobsRaw(::grpc::ClientContext* context, const ::proto::JobBatch& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::proto::JobResult>* AsyncExecuteJobsRaw(::grpc::ClientContext* context, const ::proto::JobBatch& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::proto::JobResult>* PrepareAsyncExecuteJobsRaw(::grpc::ClientContext* context, const ::proto::JobBatch& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderWriterInterface< ::proto::SessionRequest, ::proto::SessionResult>* SessionRaw(::grpc::ClientContext* context) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::proto::SessionRequest, ::proto::SessionResult>* AsyncSessionRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::proto::SessionRequest, ::proto::SessionResult>* PrepareAsyncSessionRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
-    Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel);
+    Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
     std::unique_ptr< ::grpc::ClientReader< ::proto::Job>> GetJobs(::grpc::ClientContext* context, const ::proto::Empty& request) {
       return std::unique_ptr< ::grpc::ClientReader< ::proto::Job>>(GetJobsRaw(context, request));
     }
@@ -120,44 +179,84 @@ class Plugin final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::proto::JobResult>> PrepareAsyncExecuteJob(::grpc::ClientContext* context, const ::proto::Job& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::proto::JobResult>>(PrepareAsyncExecuteJobRaw(context, request, cq));
     }
-    class experimental_async final :
-      public StubInterface::experimental_async_interface {
+    ::grpc::Status Execute(::grpc::ClientContext* context, const ::proto::ExecuteRequest& request, ::proto::JobResult* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::proto::JobResult>> AsyncExecute(::grpc::ClientContext* context, const ::proto::ExecuteRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::proto::JobResult>>(AsyncExecuteRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::proto::JobResult>> PrepareAsyncExecute(::grpc::ClientContext* context, const ::proto::ExecuteRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::proto::JobResult>>(PrepareAsyncExecuteRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReader< ::proto::JobOutput>> ExecuteJobStream(::grpc::ClientContext* context, const ::proto::Job& request) {
+      return std::unique_ptr< ::grpc::ClientReader< ::proto::JobOutput>>(ExecuteJobStreamRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::proto::JobOutput>> AsyncExecuteJobStream(::grpc::ClientContext* context, const ::proto::Job& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::proto::JobOutput>>(AsyncExecuteJobStreamRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::proto::JobOutput>> PrepareAsyncExecuteJobStream(::grpc::ClientContext* context, const ::proto::Job& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::proto::JobOutput>>(PrepareAsyncExecuteJobStreamRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReader< ::proto::JobResult>> ExecuteJobs(::grpc::ClientContext* context, const ::proto::JobBatch& request) {
+      return std::unique_ptr< ::grpc::ClientReader< ::proto::JobResult>>(ExecuteJobsRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::proto::JobResult>> AsyncExecuteJobs(::grpc::ClientContext* context, const ::proto::JobBatch& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::proto::JobResult>>(AsyncExecuteJobsRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::proto::JobResult>> PrepareAsyncExecuteJobs(::grpc::ClientContext* context, const ::proto::JobBatch& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::proto::JobResult>>(PrepareAsyncExecuteJobsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderWriter< ::proto::SessionRequest, ::proto::SessionResult>> Session(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriter< ::proto::SessionRequest, ::proto::SessionResult>>(SessionRaw(context));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::proto::SessionRequest, ::proto::SessionResult>> AsyncSession(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::proto::SessionRequest, ::proto::SessionResult>>(AsyncSessionRaw(context, cq, tag));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::proto::SessionRequest, ::proto::SessionResult>> PrepareAsyncSession(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::proto::SessionRequest, ::proto::SessionResult>>(PrepareAsyncSessionRaw(context, cq));
+    }
+    class async final :
+      public StubInterface::async_interface {
      public:
-      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-      void GetJobs(::grpc::ClientContext* context, ::proto::Empty* request, ::grpc::ClientReadReactor< ::proto::Job>* reactor) override;
-      #else
-      void GetJobs(::grpc::ClientContext* context, ::proto::Empty* request, ::grpc::experimental::ClientReadReactor< ::proto::Job>* reactor) override;
-      #endif
+      void GetJobs(::grpc::ClientContext* context, const ::proto::Empty* request, ::grpc::ClientReadReactor< ::proto::Job>* reactor) override;
       void ExecuteJob(::grpc::ClientContext* context, const ::proto::Job* request, ::proto::JobResult* response, std::function<void(::grpc::Status)>) override;
-      void ExecuteJob(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::proto::JobResult* response, std::function<void(::grpc::Status)>) override;
-      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
       void ExecuteJob(::grpc::ClientContext* context, const ::proto::Job* request, ::proto::JobResult* response, ::grpc::ClientUnaryReactor* reactor) override;
-      #else
-      void ExecuteJob(::grpc::ClientContext* context, const ::proto::Job* request, ::proto::JobResult* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
-      #endif
-      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-      void ExecuteJob(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::proto::JobResult* response, ::grpc::ClientUnaryReactor* reactor) override;
-      #else
-      void ExecuteJob(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::proto::JobResult* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
-      #endif
+      void Execute(::grpc::ClientContext* context, const ::proto::ExecuteRequest* request, ::proto::JobResult* response, std::function<void(::grpc::Status)>) override;
+      void Execute(::grpc::ClientContext* context, const ::proto::ExecuteRequest* request, ::proto::JobResult* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void ExecuteJobStream(::grpc::ClientContext* context, const ::proto::Job* request, ::grpc::ClientReadReactor< ::proto::JobOutput>* reactor) override;
+      void ExecuteJobs(::grpc::ClientContext* context, const ::proto::JobBatch* request, ::grpc::ClientReadReactor< ::proto::JobResult>* reactor) override;
+      void Session(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::proto::SessionRequest,::proto::SessionResult>* reactor) override;
      private:
       friend class Stub;
-      explicit experimental_async(Stub* stub): stub_(stub) { }
+      explicit async(Stub* stub): stub_(stub) { }
       Stub* stub() { return stub_; }
       Stub* stub_;
     };
-    class experimental_async_interface* experimental_async() override { return &async_stub_; }
+    class async* async() override { return &async_stub_; }
 
    private:
     std::shared_ptr< ::grpc::ChannelInterface> channel_;
-    class experimental_async async_stub_{this};
+    class async async_stub_{this};
     ::grpc::ClientReader< ::proto::Job>* GetJobsRaw(::grpc::ClientContext* context, const ::proto::Empty& request) override;
     ::grpc::ClientAsyncReader< ::proto::Job>* AsyncGetJobsRaw(::grpc::ClientContext* context, const ::proto::Empty& request, ::grpc::CompletionQueue* cq, void* tag) override;
     ::grpc::ClientAsyncReader< ::proto::Job>* PrepareAsyncGetJobsRaw(::grpc::ClientContext* context, const ::proto::Empty& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::proto::JobResult>* AsyncExecuteJobRaw(::grpc::ClientContext* context, const ::proto::Job& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::proto::JobResult>* PrepareAsyncExecuteJobRaw(::grpc::ClientContext* context, const ::proto::Job& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::proto::JobResult>* AsyncExecuteRaw(::grpc::ClientContext* context, const ::proto::ExecuteRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::proto::JobResult>* PrepareAsyncExecuteRaw(::grpc::ClientContext* context, const ::proto::ExecuteRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::proto::JobOutput>* ExecuteJobStreamRaw(::grpc::ClientContext* context, const ::proto::Job& request) override;
+    ::grpc::ClientAsyncReader< ::proto::JobOutput>* AsyncExecuteJobStreamRaw(::grpc::ClientContext* context, const ::proto::Job& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::proto::JobOutput>* PrepareAsyncExecuteJobStreamRaw(::grpc::ClientContext* context, const ::proto::Job& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::proto::JobResult>* ExecuteJobsRaw(::grpc::ClientContext* context, const ::proto::JobBatch& request) override;
+    ::grpc::ClientAsyncReader< ::proto::JobResult>* AsyncExecuteJobsRaw(::grpc::ClientContext* context, const ::proto::JobBatch& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::proto::JobResult>* PrepareAsyncExecuteJobsRaw(::grpc::ClientContext* context, const ::proto::JobBatch& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReaderWriter< ::proto::SessionRequest, ::proto::SessionResult>* SessionRaw(::grpc::ClientContext* context) override;
+    ::grpc::ClientAsyncReaderWriter< ::proto::SessionRequest, ::proto::SessionResult>* AsyncSessionRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReaderWriter< ::proto::SessionRequest, ::proto::SessionResult>* PrepareAsyncSessionRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_GetJobs_;
     const ::grpc::internal::RpcMethod rpcmethod_ExecuteJob_;
+    const ::grpc::internal::RpcMethod rpcmethod_Execute_;
+    const ::grpc::internal::RpcMethod rpcmethod_ExecuteJobStream_;
+    const ::grpc::internal::RpcMethod rpcmethod_ExecuteJobs_;
+    const ::grpc::internal::RpcMethod rpcmethod_Session_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -171,6 +270,24 @@ class Plugin final {
     // ExecuteJob signals the plugin to execute the given job.
     // Used to execute one job from a pipeline.
     virtual ::grpc::Status ExecuteJob(::grpc::ServerContext* context, const ::proto::Job* request, ::proto::JobResult* response);
+    // Execute signals the plugin to execute the given job like
+    // ExecuteJob, without the job fields the plugin does not need.
+    // Available from protocol version 3 on.
+    virtual ::grpc::Status Execute(::grpc::ServerContext* context, const ::proto::ExecuteRequest* request, ::proto::JobResult* response);
+    // ExecuteJobStream signals the plugin to execute the given job.
+    // Streams the log output of the job while it runs and its result
+    // once it has finished.
+    virtual ::grpc::Status ExecuteJobStream(::grpc::ServerContext* context, const ::proto::Job* request, ::grpc::ServerWriter< ::proto::JobOutput>* writer);
+    // ExecuteJobs signals the plugin to execute the given jobs in
+    // dependency order. Independent jobs run in parallel. Returns the
+    // result of every job once it has finished. No further jobs are
+    // started after a job failed, they get a failed result at the end.
+    virtual ::grpc::Status ExecuteJobs(::grpc::ServerContext* context, const ::proto::JobBatch* request, ::grpc::ServerWriter< ::proto::JobResult>* writer);
+    // Session executes the jobs Gaia sends over a single long-lived
+    // stream. Every result is sent once its job has finished, so results
+    // may arrive out of order and are matched by correlation id.
+    // Available from protocol version 3 on.
+    virtual ::grpc::Status Session(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::proto::SessionResult, ::proto::SessionRequest>* stream);
   };
   template <class BaseClass>
   class WithAsyncMethod_GetJobs : public BaseClass {
@@ -212,29 +329,99 @@ class Plugin final {
       ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_GetJobs<WithAsyncMethod_ExecuteJob<Service > > AsyncService;
   template <class BaseClass>
-  class ExperimentalWithCallbackMethod_GetJobs : public BaseClass {
+  class WithAsyncMethod_Execute : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    ExperimentalWithCallbackMethod_GetJobs() {
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-      ::grpc::Service::
-    #else
-      ::grpc::Service::experimental().
-    #endif
-        MarkMethodCallback(0,
-          new ::grpc_impl::internal::CallbackServerStreamingHandler< ::proto::Empty, ::proto::Job>(
+    WithAsyncMethod_Execute() {
+      ::grpc::Service::MarkMethodAsync(2);
+    }
+    ~WithAsyncMethod_Execute() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Execute(::grpc::ServerContext* /*context*/, const ::proto::ExecuteRequest* /*request*/, ::proto::JobResult* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestExecute(::grpc::ServerContext* context, ::proto::ExecuteRequest* request, ::grpc::ServerAsyncResponseWriter< ::proto::JobResult>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_ExecuteJobStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_ExecuteJobStream() {
+      ::grpc::Service::MarkMethodAsync(3);
+    }
+    ~WithAsyncMethod_ExecuteJobStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ExecuteJobStream(::grpc::ServerContext* /*context*/, const ::proto::Job* /*request*/, ::grpc::ServerWriter< ::proto::JobOutput>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestExecuteJobStream(::grpc::ServerContext* context, ::proto::Job* request, ::grpc::ServerAsyncWriter< ::proto::JobOutput>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(3, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_ExecuteJobs : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_ExecuteJobs() {
+      ::grpc::Service::MarkMethodAsync(4);
+    }
+    ~WithAsyncMethod_ExecuteJobs() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ExecuteJobs(::grpc::ServerContext* /*context*/, const ::proto::JobBatch* /*request*/, ::grpc::ServerWriter< ::proto::JobResult>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestExecuteJobs(::grpc::ServerContext* context, ::proto::JobBatch* request, ::grpc::ServerAsyncWriter< ::proto::JobResult>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(4, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_Session : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_Session() {
+      ::grpc::Service::MarkMethodAsync(5);
+    }
+    ~WithAsyncMethod_Session() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Session(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::proto::SessionResult, ::proto::SessionRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSession(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::proto::SessionResult, ::proto::SessionRequest>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(5, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_GetJobs<WithAsyncMethod_ExecuteJob<WithAsyncMethod_Execute<WithAsyncMethod_ExecuteJobStream<WithAsyncMethod_ExecuteJobs<WithAsyncMethod_Session<Service > > > > > > AsyncService;
+  template <class BaseClass>
+  class WithCallbackMethod_GetJobs : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_GetJobs() {
+      ::grpc::Service::MarkMethodCallback(0,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::proto::Empty, ::proto::Job>(
             [this](
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-                   ::grpc::CallbackServerContext*
-    #else
-                   ::grpc::experimental::CallbackServerContext*
-    #endif
-                     context, const ::proto::Empty* request) { return this->GetJobs(context, request); }));
+                   ::grpc::CallbackServerContext* context, const ::proto::Empty* request) { return this->GetJobs(context, request); }));
     }
-    ~ExperimentalWithCallbackMethod_GetJobs() override {
+    ~WithCallbackMethod_GetJobs() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
@@ -242,46 +429,26 @@ class Plugin final {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
     virtual ::grpc::ServerWriteReactor< ::proto::Job>* GetJobs(
-      ::grpc::CallbackServerContext* /*context*/, const ::proto::Empty* /*request*/)
-    #else
-    virtual ::grpc::experimental::ServerWriteReactor< ::proto::Job>* GetJobs(
-      ::grpc::experimental::CallbackServerContext* /*context*/, const ::proto::Empty* /*request*/)
-    #endif
-      { return nullptr; }
+      ::grpc::CallbackServerContext* /*context*/, const ::proto::Empty* /*request*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class ExperimentalWithCallbackMethod_ExecuteJob : public BaseClass {
+  class WithCallbackMethod_ExecuteJob : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    ExperimentalWithCallbackMethod_ExecuteJob() {
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-      ::grpc::Service::
-    #else
-      ::grpc::Service::experimental().
-    #endif
-        MarkMethodCallback(1,
-          new ::grpc_impl::internal::CallbackUnaryHandler< ::proto::Job, ::proto::JobResult>(
+    WithCallbackMethod_ExecuteJob() {
+      ::grpc::Service::MarkMethodCallback(1,
+          new ::grpc::internal::CallbackUnaryHandler< ::proto::Job, ::proto::JobResult>(
             [this](
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-                   ::grpc::CallbackServerContext*
-    #else
-                   ::grpc::experimental::CallbackServerContext*
-    #endif
-                     context, const ::proto::Job* request, ::proto::JobResult* response) { return this->ExecuteJob(context, request, response); }));}
+                   ::grpc::CallbackServerContext* context, const ::proto::Job* request, ::proto::JobResult* response) { return this->ExecuteJob(context, request, response); }));}
     void SetMessageAllocatorFor_ExecuteJob(
-        ::grpc::experimental::MessageAllocator< ::proto::Job, ::proto::JobResult>* allocator) {
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+        ::grpc::MessageAllocator< ::proto::Job, ::proto::JobResult>* allocator) {
       ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(1);
-    #else
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::experimental().GetHandler(1);
-    #endif
-      static_cast<::grpc_impl::internal::CallbackUnaryHandler< ::proto::Job, ::proto::JobResult>*>(handler)
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::proto::Job, ::proto::JobResult>*>(handler)
               ->SetMessageAllocator(allocator);
     }
-    ~ExperimentalWithCallbackMethod_ExecuteJob() override {
+    ~WithCallbackMethod_ExecuteJob() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
@@ -289,20 +456,105 @@ class Plugin final {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
     virtual ::grpc::ServerUnaryReactor* ExecuteJob(
-      ::grpc::CallbackServerContext* /*context*/, const ::proto::Job* /*request*/, ::proto::JobResult* /*response*/)
-    #else
-    virtual ::grpc::experimental::ServerUnaryReactor* ExecuteJob(
-      ::grpc::experimental::CallbackServerContext* /*context*/, const ::proto::Job* /*request*/, ::proto::JobResult* /*response*/)
-    #endif
+      ::grpc::CallbackServerContext* /*context*/, const ::proto::Job* /*request*/, ::proto::JobResult* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_Execute : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_Execute() {
+      ::grpc::Service::MarkMethodCallback(2,
+          new ::grpc::internal::CallbackUnaryHandler< ::proto::ExecuteRequest, ::proto::JobResult>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::proto::ExecuteRequest* request, ::proto::JobResult* response) { return this->Execute(context, request, response); }));}
+    void SetMessageAllocatorFor_Execute(
+        ::grpc::MessageAllocator< ::proto::ExecuteRequest, ::proto::JobResult>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(2);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::proto::ExecuteRequest, ::proto::JobResult>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_Execute() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Execute(::grpc::ServerContext* /*context*/, const ::proto::ExecuteRequest* /*request*/, ::proto::JobResult* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* Execute(
+      ::grpc::CallbackServerContext* /*context*/, const ::proto::ExecuteRequest* /*request*/, ::proto::JobResult* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_ExecuteJobStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_ExecuteJobStream() {
+      ::grpc::Service::MarkMethodCallback(3,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::proto::Job, ::proto::JobOutput>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::proto::Job* request) { return this->ExecuteJobStream(context, request); }));
+    }
+    ~WithCallbackMethod_ExecuteJobStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ExecuteJobStream(::grpc::ServerContext* /*context*/, const ::proto::Job* /*request*/, ::grpc::ServerWriter< ::proto::JobOutput>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::proto::JobOutput>* ExecuteJobStream(
+      ::grpc::CallbackServerContext* /*context*/, const ::proto::Job* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_ExecuteJobs : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_ExecuteJobs() {
+      ::grpc::Service::MarkMethodCallback(4,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::proto::JobBatch, ::proto::JobResult>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::proto::JobBatch* request) { return this->ExecuteJobs(context, request); }));
+    }
+    ~WithCallbackMethod_ExecuteJobs() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ExecuteJobs(::grpc::ServerContext* /*context*/, const ::proto::JobBatch* /*request*/, ::grpc::ServerWriter< ::proto::JobResult>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::proto::JobResult>* ExecuteJobs(
+      ::grpc::CallbackServerContext* /*context*/, const ::proto::JobBatch* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_Session : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_Session() {
+      ::grpc::Service::MarkMethodCallback(5,
+          new ::grpc::internal::CallbackBidiHandler< ::proto::SessionRequest, ::proto::SessionResult>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->Session(context); }));
+    }
+    ~WithCallbackMethod_Session() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Session(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::proto::SessionResult, ::proto::SessionRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::proto::SessionRequest, ::proto::SessionResult>* Session(
+      ::grpc::CallbackServerContext* /*context*/)
       { return nullptr; }
   };
-  #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-  typedef ExperimentalWithCallbackMethod_GetJobs<ExperimentalWithCallbackMethod_ExecuteJob<Service > > CallbackService;
-  #endif
-
-  typedef ExperimentalWithCallbackMethod_GetJobs<ExperimentalWithCallbackMethod_ExecuteJob<Service > > ExperimentalCallbackService;
+  typedef WithCallbackMethod_GetJobs<WithCallbackMethod_ExecuteJob<WithCallbackMethod_Execute<WithCallbackMethod_ExecuteJobStream<WithCallbackMethod_ExecuteJobs<WithCallbackMethod_Session<Service > > > > > > CallbackService;
+  typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_GetJobs : public BaseClass {
    private:
@@ -338,6 +590,74 @@ class Plugin final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_Execute : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_Execute() {
+      ::grpc::Service::MarkMethodGeneric(2);
+    }
+    ~WithGenericMethod_Execute() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Execute(::grpc::ServerContext* /*context*/, const ::proto::ExecuteRequest* /*request*/, ::proto::JobResult* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_ExecuteJobStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_ExecuteJobStream() {
+      ::grpc::Service::MarkMethodGeneric(3);
+    }
+    ~WithGenericMethod_ExecuteJobStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ExecuteJobStream(::grpc::ServerContext* /*context*/, const ::proto::Job* /*request*/, ::grpc::ServerWriter< ::proto::JobOutput>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_ExecuteJobs : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_ExecuteJobs() {
+      ::grpc::Service::MarkMethodGeneric(4);
+    }
+    ~WithGenericMethod_ExecuteJobs() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ExecuteJobs(::grpc::ServerContext* /*context*/, const ::proto::JobBatch* /*request*/, ::grpc::ServerWriter< ::proto::JobResult>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_Session : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_Session() {
+      ::grpc::Service::MarkMethodGeneric(5);
+    }
+    ~WithGenericMethod_Session() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Session(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::proto::SessionResult, ::proto::SessionRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_GetJobs : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -378,27 +698,97 @@ class Plugin final {
     }
   };
   template <class BaseClass>
-  class ExperimentalWithRawCallbackMethod_GetJobs : public BaseClass {
+  class WithRawMethod_Execute : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_Execute() {
+      ::grpc::Service::MarkMethodRaw(2);
+    }
+    ~WithRawMethod_Execute() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Execute(::grpc::ServerContext* /*context*/, const ::proto::ExecuteRequest* /*request*/, ::proto::JobResult* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestExecute(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_ExecuteJobStream : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    ExperimentalWithRawCallbackMethod_GetJobs() {
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-      ::grpc::Service::
-    #else
-      ::grpc::Service::experimental().
-    #endif
-        MarkMethodRawCallback(0,
-          new ::grpc_impl::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+    WithRawMethod_ExecuteJobStream() {
+      ::grpc::Service::MarkMethodRaw(3);
+    }
+    ~WithRawMethod_ExecuteJobStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ExecuteJobStream(::grpc::ServerContext* /*context*/, const ::proto::Job* /*request*/, ::grpc::ServerWriter< ::proto::JobOutput>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestExecuteJobStream(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(3, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_ExecuteJobs : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_ExecuteJobs() {
+      ::grpc::Service::MarkMethodRaw(4);
+    }
+    ~WithRawMethod_ExecuteJobs() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ExecuteJobs(::grpc::ServerContext* /*context*/, const ::proto::JobBatch* /*request*/, ::grpc::ServerWriter< ::proto::JobResult>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestExecuteJobs(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(4, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_Session : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_Session() {
+      ::grpc::Service::MarkMethodRaw(5);
+    }
+    ~WithRawMethod_Session() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Session(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::proto::SessionResult, ::proto::SessionRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSession(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(5, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_GetJobs : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_GetJobs() {
+      ::grpc::Service::MarkMethodRawCallback(0,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-                   ::grpc::CallbackServerContext*
-    #else
-                   ::grpc::experimental::CallbackServerContext*
-    #endif
-                     context, const::grpc::ByteBuffer* request) { return this->GetJobs(context, request); }));
+                   ::grpc::CallbackServerContext* context, const::grpc::ByteBuffer* request) { return this->GetJobs(context, request); }));
     }
-    ~ExperimentalWithRawCallbackMethod_GetJobs() override {
+    ~WithRawCallbackMethod_GetJobs() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
@@ -406,37 +796,21 @@ class Plugin final {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
     virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* GetJobs(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)
-    #else
-    virtual ::grpc::experimental::ServerWriteReactor< ::grpc::ByteBuffer>* GetJobs(
-      ::grpc::experimental::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)
-    #endif
-      { return nullptr; }
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class ExperimentalWithRawCallbackMethod_ExecuteJob : public BaseClass {
+  class WithRawCallbackMethod_ExecuteJob : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    ExperimentalWithRawCallbackMethod_ExecuteJob() {
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-      ::grpc::Service::
-    #else
-      ::grpc::Service::experimental().
-    #endif
-        MarkMethodRawCallback(1,
-          new ::grpc_impl::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+    WithRawCallbackMethod_ExecuteJob() {
+      ::grpc::Service::MarkMethodRawCallback(1,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-                   ::grpc::CallbackServerContext*
-    #else
-                   ::grpc::experimental::CallbackServerContext*
-    #endif
-                     context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ExecuteJob(context, request, response); }));
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ExecuteJob(context, request, response); }));
     }
-    ~ExperimentalWithRawCallbackMethod_ExecuteJob() override {
+    ~WithRawCallbackMethod_ExecuteJob() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
@@ -444,13 +818,96 @@ class Plugin final {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
     virtual ::grpc::ServerUnaryReactor* ExecuteJob(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
-    #else
-    virtual ::grpc::experimental::ServerUnaryReactor* ExecuteJob(
-      ::grpc::experimental::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
-    #endif
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_Execute : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_Execute() {
+      ::grpc::Service::MarkMethodRawCallback(2,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->Execute(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_Execute() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Execute(::grpc::ServerContext* /*context*/, const ::proto::ExecuteRequest* /*request*/, ::proto::JobResult* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* Execute(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_ExecuteJobStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_ExecuteJobStream() {
+      ::grpc::Service::MarkMethodRawCallback(3,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const::grpc::ByteBuffer* request) { return this->ExecuteJobStream(context, request); }));
+    }
+    ~WithRawCallbackMethod_ExecuteJobStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ExecuteJobStream(::grpc::ServerContext* /*context*/, const ::proto::Job* /*request*/, ::grpc::ServerWriter< ::proto::JobOutput>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* ExecuteJobStream(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_ExecuteJobs : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_ExecuteJobs() {
+      ::grpc::Service::MarkMethodRawCallback(4,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const::grpc::ByteBuffer* request) { return this->ExecuteJobs(context, request); }));
+    }
+    ~WithRawCallbackMethod_ExecuteJobs() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ExecuteJobs(::grpc::ServerContext* /*context*/, const ::proto::JobBatch* /*request*/, ::grpc::ServerWriter< ::proto::JobResult>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* ExecuteJobs(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_Session : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_Session() {
+      ::grpc::Service::MarkMethodRawCallback(5,
+          new ::grpc::internal::CallbackBidiHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->Session(context); }));
+    }
+    ~WithRawCallbackMethod_Session() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Session(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::proto::SessionResult, ::proto::SessionRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* Session(
+      ::grpc::CallbackServerContext* /*context*/)
       { return nullptr; }
   };
   template <class BaseClass>
@@ -462,8 +919,8 @@ class Plugin final {
       ::grpc::Service::MarkMethodStreamed(1,
         new ::grpc::internal::StreamedUnaryHandler<
           ::proto::Job, ::proto::JobResult>(
-            [this](::grpc_impl::ServerContext* context,
-                   ::grpc_impl::ServerUnaryStreamer<
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
                      ::proto::Job, ::proto::JobResult>* streamer) {
                        return this->StreamedExecuteJob(context,
                          streamer);
@@ -480,7 +937,34 @@ class Plugin final {
     // replace default version of method with streamed unary
     virtual ::grpc::Status StreamedExecuteJob(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::proto::Job,::proto::JobResult>* server_unary_streamer) = 0;
   };
-  typedef WithStreamedUnaryMethod_ExecuteJob<Service > StreamedUnaryService;
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_Execute : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_Execute() {
+      ::grpc::Service::MarkMethodStreamed(2,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::proto::ExecuteRequest, ::proto::JobResult>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::proto::ExecuteRequest, ::proto::JobResult>* streamer) {
+                       return this->StreamedExecute(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_Execute() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status Execute(::grpc::ServerContext* /*context*/, const ::proto::ExecuteRequest* /*request*/, ::proto::JobResult* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedExecute(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::proto::ExecuteRequest,::proto::JobResult>* server_unary_streamer) = 0;
+  };
+  typedef WithStreamedUnaryMethod_ExecuteJob<WithStreamedUnaryMethod_Execute<Service > > StreamedUnaryService;
   template <class BaseClass>
   class WithSplitStreamingMethod_GetJobs : public BaseClass {
    private:
@@ -490,8 +974,8 @@ class Plugin final {
       ::grpc::Service::MarkMethodStreamed(0,
         new ::grpc::internal::SplitServerStreamingHandler<
           ::proto::Empty, ::proto::Job>(
-            [this](::grpc_impl::ServerContext* context,
-                   ::grpc_impl::ServerSplitStreamer<
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerSplitStreamer<
                      ::proto::Empty, ::proto::Job>* streamer) {
                        return this->StreamedGetJobs(context,
                          streamer);
@@ -508,8 +992,62 @@ class Plugin final {
     // replace default version of method with split streamed
     virtual ::grpc::Status StreamedGetJobs(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::proto::Empty,::proto::Job>* server_split_streamer) = 0;
   };
-  typedef WithSplitStreamingMethod_GetJobs<Service > SplitStreamedService;
-  typedef WithSplitStreamingMethod_GetJobs<WithStreamedUnaryMethod_ExecuteJob<Service > > StreamedService;
+  template <class BaseClass>
+  class WithSplitStreamingMethod_ExecuteJobStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_ExecuteJobStream() {
+      ::grpc::Service::MarkMethodStreamed(3,
+        new ::grpc::internal::SplitServerStreamingHandler<
+          ::proto::Job, ::proto::JobOutput>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerSplitStreamer<
+                     ::proto::Job, ::proto::JobOutput>* streamer) {
+                       return this->StreamedExecuteJobStream(context,
+                         streamer);
+                  }));
+    }
+    ~WithSplitStreamingMethod_ExecuteJobStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status ExecuteJobStream(::grpc::ServerContext* /*context*/, const ::proto::Job* /*request*/, ::grpc::ServerWriter< ::proto::JobOutput>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status StreamedExecuteJobStream(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::proto::Job,::proto::JobOutput>* server_split_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithSplitStreamingMethod_ExecuteJobs : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_ExecuteJobs() {
+      ::grpc::Service::MarkMethodStreamed(4,
+        new ::grpc::internal::SplitServerStreamingHandler<
+          ::proto::JobBatch, ::proto::JobResult>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerSplitStreamer<
+                     ::proto::JobBatch, ::proto::JobResult>* streamer) {
+                       return this->StreamedExecuteJobs(context,
+                         streamer);
+                  }));
+    }
+    ~WithSplitStreamingMethod_ExecuteJobs() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status ExecuteJobs(::grpc::ServerContext* /*context*/, const ::proto::JobBatch* /*request*/, ::grpc::ServerWriter< ::proto::JobResult>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status StreamedExecuteJobs(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::proto::JobBatch,::proto::JobResult>* server_split_streamer) = 0;
+  };
+  typedef WithSplitStreamingMethod_GetJobs<WithSplitStreamingMethod_ExecuteJobStream<WithSplitStreamingMethod_ExecuteJobs<Service > > > SplitStreamedService;
+  typedef WithSplitStreamingMethod_GetJobs<WithStreamedUnaryMethod_ExecuteJob<WithStreamedUnaryMethod_Execute<WithSplitStreamingMethod_ExecuteJobStream<WithSplitStreamingMethod_ExecuteJobs<Service > > > > > StreamedService;
 };
 
 }  // namespace proto
@@ -14,211 +14,347 @@
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
-extern PROTOBUF_INTERNAL_EXPORT_plugin_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Argument_plugin_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_plugin_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ManualInteraction_plugin_2eproto;
-namespace proto {
-class JobDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Job> _instance;
-} _Job_default_instance_;
-class ArgumentDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Argument> _instance;
-} _Argument_default_instance_;
-class ManualInteractionDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<ManualInteraction> _instance;
-} _ManualInteraction_default_instance_;
-class JobResultDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<JobResult> _instance;
-} _JobResult_default_instance_;
-class EmptyDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Empty> _instance;
-} _Empty_default_instance_;
-}  // namespace proto
-static void InitDefaultsscc_info_Argument_plugin_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::proto::_Argument_default_instance_;
-    new (ptr) ::proto::Argument();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::proto::Argument::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Argument_plugin_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_Argument_plugin_2eproto}, {}};
-
-static void InitDefaultsscc_info_Empty_plugin_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::proto::_Empty_default_instance_;
-    new (ptr) ::proto::Empty();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::proto::Empty::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Empty_plugin_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_Empty_plugin_2eproto}, {}};
-
-static void InitDefaultsscc_info_Job_plugin_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::proto::_Job_default_instance_;
-    new (ptr) ::proto::Job();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::proto::Job::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_Job_plugin_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 2, 0, InitDefaultsscc_info_Job_plugin_2eproto}, {
-      &scc_info_Argument_plugin_2eproto.base,
-      &scc_info_ManualInteraction_plugin_2eproto.base,}};
 
-static void InitDefaultsscc_info_JobResult_plugin_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::proto::_JobResult_default_instance_;
-    new (ptr) ::proto::JobResult();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::proto::JobResult::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_JobResult_plugin_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_JobResult_plugin_2eproto}, {}};
-
-static void InitDefaultsscc_info_ManualInteraction_plugin_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::proto::_ManualInteraction_default_instance_;
-    new (ptr) ::proto::ManualInteraction();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::proto::ManualInteraction::InitAsDefaultInstance();
-}
+PROTOBUF_PRAGMA_INIT_SEG
 
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ManualInteraction_plugin_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_ManualInteraction_plugin_2eproto}, {}};
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_plugin_2eproto[5];
-static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_plugin_2eproto = nullptr;
-static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_plugin_2eproto = nullptr;
+namespace proto {
+PROTOBUF_CONSTEXPR Job::Job(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.dependson_)*/{}
+  , /*decltype(_impl_._dependson_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.args_)*/{}
+  , /*decltype(_impl_.dependson64_)*/{}
+  , /*decltype(_impl_._dependson64_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.title_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.description_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.interaction_)*/nullptr
+  , /*decltype(_impl_.unique_id64_)*/uint64_t{0u}
+  , /*decltype(_impl_.unique_id_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct JobDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR JobDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~JobDefaultTypeInternal() {}
+  union {
+    Job _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 JobDefaultTypeInternal _Job_default_instance_;
+PROTOBUF_CONSTEXPR Argument::Argument(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.description_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.type_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ArgumentDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ArgumentDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ArgumentDefaultTypeInternal() {}
+  union {
+    Argument _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ArgumentDefaultTypeInternal _Argument_default_instance_;
+PROTOBUF_CONSTEXPR ExecuteRequest::ExecuteRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.args_)*/{}
+  , /*decltype(_impl_.unique_id64_)*/uint64_t{0u}
+  , /*decltype(_impl_.unique_id_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ExecuteRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ExecuteRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ExecuteRequestDefaultTypeInternal() {}
+  union {
+    ExecuteRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ExecuteRequestDefaultTypeInternal _ExecuteRequest_default_instance_;
+PROTOBUF_CONSTEXPR ManualInteraction::ManualInteraction(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.description_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.type_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ManualInteractionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ManualInteractionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ManualInteractionDefaultTypeInternal() {}
+  union {
+    ManualInteraction _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ManualInteractionDefaultTypeInternal _ManualInteraction_default_instance_;
+PROTOBUF_CONSTEXPR JobResult::JobResult(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.unique_id_)*/0u
+  , /*decltype(_impl_.failed_)*/false
+  , /*decltype(_impl_.exit_pipeline_)*/false
+  , /*decltype(_impl_.unique_id64_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct JobResultDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR JobResultDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~JobResultDefaultTypeInternal() {}
+  union {
+    JobResult _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 JobResultDefaultTypeInternal _JobResult_default_instance_;
+PROTOBUF_CONSTEXPR JobOutput::JobOutput(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.output_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct JobOutputDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR JobOutputDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~JobOutputDefaultTypeInternal() {}
+  union {
+    JobOutput _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 JobOutputDefaultTypeInternal _JobOutput_default_instance_;
+PROTOBUF_CONSTEXPR JobBatch::JobBatch(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.jobs_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct JobBatchDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR JobBatchDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~JobBatchDefaultTypeInternal() {}
+  union {
+    JobBatch _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 JobBatchDefaultTypeInternal _JobBatch_default_instance_;
+PROTOBUF_CONSTEXPR SessionRequest::SessionRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.execute_)*/nullptr
+  , /*decltype(_impl_.correlation_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.cancel_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SessionRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SessionRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SessionRequestDefaultTypeInternal() {}
+  union {
+    SessionRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SessionRequestDefaultTypeInternal _SessionRequest_default_instance_;
+PROTOBUF_CONSTEXPR SessionResult::SessionResult(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.status_message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.result_)*/nullptr
+  , /*decltype(_impl_.correlation_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.status_code_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SessionResultDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SessionResultDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SessionResultDefaultTypeInternal() {}
+  union {
+    SessionResult _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SessionResultDefaultTypeInternal _SessionResult_default_instance_;
+PROTOBUF_CONSTEXPR Empty::Empty(
+    ::_pbi::ConstantInitialized) {}
+struct EmptyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EmptyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EmptyDefaultTypeInternal() {}
+  union {
+    Empty _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EmptyDefaultTypeInternal _Empty_default_instance_;
+}  // namespace proto
+static ::_pb::Metadata file_level_metadata_plugin_2eproto[10];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_plugin_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_plugin_2eproto = nullptr;
 
-const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_plugin_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+const uint32_t TableStruct_plugin_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::proto::Job, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::proto::Job, unique_id_),
-  PROTOBUF_FIELD_OFFSET(::proto::Job, title_),
-  PROTOBUF_FIELD_OFFSET(::proto::Job, description_),
-  PROTOBUF_FIELD_OFFSET(::proto::Job, dependson_),
-  PROTOBUF_FIELD_OFFSET(::proto::Job, args_),
-  PROTOBUF_FIELD_OFFSET(::proto::Job, interaction_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto::Job, _impl_.unique_id_),
+  PROTOBUF_FIELD_OFFSET(::proto::Job, _impl_.title_),
+  PROTOBUF_FIELD_OFFSET(::proto::Job, _impl_.description_),
+  PROTOBUF_FIELD_OFFSET(::proto::Job, _impl_.dependson_),
+  PROTOBUF_FIELD_OFFSET(::proto::Job, _impl_.args_),
+  PROTOBUF_FIELD_OFFSET(::proto::Job, _impl_.interaction_),
+  PROTOBUF_FIELD_OFFSET(::proto::Job, _impl_.unique_id64_),
+  PROTOBUF_FIELD_OFFSET(::proto::Job, _impl_.dependson64_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::proto::Argument, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::proto::Argument, description_),
-  PROTOBUF_FIELD_OFFSET(::proto::Argument, type_),
-  PROTOBUF_FIELD_OFFSET(::proto::Argument, key_),
-  PROTOBUF_FIELD_OFFSET(::proto::Argument, value_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto::Argument, _impl_.description_),
+  PROTOBUF_FIELD_OFFSET(::proto::Argument, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::proto::Argument, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::proto::Argument, _impl_.value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto::ExecuteRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto::ExecuteRequest, _impl_.unique_id_),
+  PROTOBUF_FIELD_OFFSET(::proto::ExecuteRequest, _impl_.args_),
+  PROTOBUF_FIELD_OFFSET(::proto::ExecuteRequest, _impl_.unique_id64_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::proto::ManualInteraction, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::proto::ManualInteraction, description_),
-  PROTOBUF_FIELD_OFFSET(::proto::ManualInteraction, type_),
-  PROTOBUF_FIELD_OFFSET(::proto::ManualInteraction, value_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto::ManualInteraction, _impl_.description_),
+  PROTOBUF_FIELD_OFFSET(::proto::ManualInteraction, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::proto::ManualInteraction, _impl_.value_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::proto::JobResult, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::proto::JobResult, unique_id_),
-  PROTOBUF_FIELD_OFFSET(::proto::JobResult, failed_),
-  PROTOBUF_FIELD_OFFSET(::proto::JobResult, exit_pipeline_),
-  PROTOBUF_FIELD_OFFSET(::proto::JobResult, message_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto::JobResult, _impl_.unique_id_),
+  PROTOBUF_FIELD_OFFSET(::proto::JobResult, _impl_.failed_),
+  PROTOBUF_FIELD_OFFSET(::proto::JobResult, _impl_.exit_pipeline_),
+  PROTOBUF_FIELD_OFFSET(::proto::JobResult, _impl_.message_),
+  PROTOBUF_FIELD_OFFSET(::proto::JobResult, _impl_.unique_id64_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto::JobOutput, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::proto::JobOutput, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::proto::JobOutput, _impl_.output_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto::JobBatch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto::JobBatch, _impl_.jobs_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto::SessionRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto::SessionRequest, _impl_.correlation_id_),
+  PROTOBUF_FIELD_OFFSET(::proto::SessionRequest, _impl_.execute_),
+  PROTOBUF_FIELD_OFFSET(::proto::SessionRequest, _impl_.cancel_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto::SessionResult, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto::SessionResult, _impl_.correlation_id_),
+  PROTOBUF_FIELD_OFFSET(::proto::SessionResult, _impl_.result_),
+  PROTOBUF_FIELD_OFFSET(::proto::SessionResult, _impl_.status_code_),
+  PROTOBUF_FIELD_OFFSET(::proto::SessionResult, _impl_.status_message_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::proto::Empty, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
 };
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::proto::Job)},
-  { 11, -1, sizeof(::proto::Argument)},
-  { 20, -1, sizeof(::proto::ManualInteraction)},
-  { 28, -1, sizeof(::proto::JobResult)},
-  { 37, -1, sizeof(::proto::Empty)},
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::proto::Job)},
+  { 14, -1, -1, sizeof(::proto::Argument)},
+  { 24, -1, -1, sizeof(::proto::ExecuteRequest)},
+  { 33, -1, -1, sizeof(::proto::ManualInteraction)},
+  { 42, -1, -1, sizeof(::proto::JobResult)},
+  { 53, -1, -1, sizeof(::proto::JobOutput)},
+  { 62, -1, -1, sizeof(::proto::JobBatch)},
+  { 69, -1, -1, sizeof(::proto::SessionRequest)},
+  { 78, -1, -1, sizeof(::proto::SessionResult)},
+  { 88, -1, -1, sizeof(::proto::Empty)},
 };
 
-static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto::_Job_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto::_Argument_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto::_ManualInteraction_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto::_JobResult_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::proto::_Empty_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::proto::_Job_default_instance_._instance,
+  &::proto::_Argument_default_instance_._instance,
+  &::proto::_ExecuteRequest_default_instance_._instance,
+  &::proto::_ManualInteraction_default_instance_._instance,
+  &::proto::_JobResult_default_instance_._instance,
+  &::proto::_JobOutput_default_instance_._instance,
+  &::proto::_JobBatch_default_instance_._instance,
+  &::proto::_SessionRequest_default_instance_._instance,
+  &::proto::_SessionResult_default_instance_._instance,
+  &::proto::_Empty_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_plugin_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
-  "\n\014plugin.proto\022\005proto\"\235\001\n\003Job\022\021\n\tunique_"
+  "\n\014plugin.proto\022\005proto\"\307\001\n\003Job\022\021\n\tunique_"
   "id\030\001 \001(\r\022\r\n\005title\030\002 \001(\t\022\023\n\013description\030\003"
   " \001(\t\022\021\n\tdependson\030\004 \003(\r\022\035\n\004args\030\005 \003(\0132\017."
   "proto.Argument\022-\n\013interaction\030\006 \001(\0132\030.pr"
-  "oto.ManualInteraction\"I\n\010Argument\022\023\n\013des"
-  "cription\030\001 \001(\t\022\014\n\004type\030\002 \001(\t\022\013\n\003key\030\003 \001("
-  "\t\022\r\n\005value\030\004 \001(\t\"E\n\021ManualInteraction\022\023\n"
-  "\013description\030\001 \001(\t\022\014\n\004type\030\002 \001(\t\022\r\n\005valu"
-  "e\030\003 \001(\t\"V\n\tJobResult\022\021\n\tunique_id\030\001 \001(\r\022"
-  "\016\n\006failed\030\002 \001(\010\022\025\n\rexit_pipeline\030\003 \001(\010\022\017"
-  "\n\007message\030\004 \001(\t\"\007\n\005Empty2[\n\006Plugin\022%\n\007Ge"
-  "tJobs\022\014.proto.Empty\032\n.proto.Job0\001\022*\n\nExe"
-  "cuteJob\022\n.proto.Job\032\020.proto.JobResultB%\n"
-  "\025io.gaiapipeline.protoB\nGRPCPluginP\001b\006pr"
-  "oto3"
+  "oto.ManualInteraction\022\023\n\013unique_id64\030\007 \001"
+  "(\004\022\023\n\013dependson64\030\010 \003(\004\"I\n\010Argument\022\023\n\013d"
+  "escription\030\001 \001(\t\022\014\n\004type\030\002 \001(\t\022\013\n\003key\030\003 "
+  "\001(\t\022\r\n\005value\030\004 \001(\t\"W\n\016ExecuteRequest\022\021\n\t"
+  "unique_id\030\001 \001(\r\022\035\n\004args\030\005 \003(\0132\017.proto.Ar"
+  "gument\022\023\n\013unique_id64\030\007 \001(\004\"E\n\021ManualInt"
+  "eraction\022\023\n\013description\030\001 \001(\t\022\014\n\004type\030\002 "
+  "\001(\t\022\r\n\005value\030\003 \001(\t\"k\n\tJobResult\022\021\n\tuniqu"
+  "e_id\030\001 \001(\r\022\016\n\006failed\030\002 \001(\010\022\025\n\rexit_pipel"
+  "ine\030\003 \001(\010\022\017\n\007message\030\004 \001(\t\022\023\n\013unique_id6"
+  "4\030\005 \001(\004\"H\n\tJobOutput\022\r\n\003log\030\001 \001(\014H\000\022\"\n\006r"
+  "esult\030\002 \001(\0132\020.proto.JobResultH\000B\010\n\006outpu"
+  "t\"$\n\010JobBatch\022\030\n\004jobs\030\001 \003(\0132\n.proto.Job\""
+  "`\n\016SessionRequest\022\026\n\016correlation_id\030\001 \001("
+  "\004\022&\n\007execute\030\002 \001(\0132\025.proto.ExecuteReques"
+  "t\022\016\n\006cancel\030\003 \001(\010\"v\n\rSessionResult\022\026\n\016co"
+  "rrelation_id\030\001 \001(\004\022 \n\006result\030\002 \001(\0132\020.pro"
+  "to.JobResult\022\023\n\013status_code\030\003 \001(\005\022\026\n\016sta"
+  "tus_message\030\004 \001(\t\"\007\n\005Empty2\263\002\n\006Plugin\022%\n"
+  "\007GetJobs\022\014.proto.Empty\032\n.proto.Job0\001\022*\n\n"
+  "ExecuteJob\022\n.proto.Job\032\020.proto.JobResult"
+  "\0222\n\007Execute\022\025.proto.ExecuteRequest\032\020.pro"
+  "to.JobResult\0222\n\020ExecuteJobStream\022\n.proto"
+  ".Job\032\020.proto.JobOutput0\001\0222\n\013ExecuteJobs\022"
+  "\017.proto.JobBatch\032\020.proto.JobResult0\001\022:\n\007"
+  "Session\022\025.proto.SessionRequest\032\024.proto.S"
+  "essionResult(\0010\001B(\n\025io.gaiapipeline.prot"
+  "oB\nGRPCPluginP\001\370\001\001b\006proto3"
   ;
-static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_plugin_2eproto_deps[1] = {
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_plugin_2eproto_sccs[5] = {
-  &scc_info_Argument_plugin_2eproto.base,
-  &scc_info_Empty_plugin_2eproto.base,
-  &scc_info_Job_plugin_2eproto.base,
-  &scc_info_JobResult_plugin_2eproto.base,
-  &scc_info_ManualInteraction_plugin_2eproto.base,
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_plugin_2eproto_once;
-static bool descriptor_table_plugin_2eproto_initialized = false;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_plugin_2eproto = {
-  &descriptor_table_plugin_2eproto_initialized, descriptor_table_protodef_plugin_2eproto, "plugin.proto", 564,
-  &descriptor_table_plugin_2eproto_once, descriptor_table_plugin_2eproto_sccs, descriptor_table_plugin_2eproto_deps, 5, 0,
-  schemas, file_default_instances, TableStruct_plugin_2eproto::offsets,
-  file_level_metadata_plugin_2eproto, 5, file_level_enum_descriptors_plugin_2eproto, file_level_service_descriptors_plugin_2eproto,
+static ::_pbi::once_flag descriptor_table_plugin_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_plugin_2eproto = {
+    false, false, 1266, descriptor_table_protodef_plugin_2eproto,
+    "plugin.proto",
+    &descriptor_table_plugin_2eproto_once, nullptr, 0, 10,
+    schemas, file_default_instances, TableStruct_plugin_2eproto::offsets,
+    file_level_metadata_plugin_2eproto, file_level_enum_descriptors_plugin_2eproto,
+    file_level_service_descriptors_plugin_2eproto,
 };
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_plugin_2eproto_getter() {
+  return &descriptor_table_plugin_2eproto;
+}
 
 // Force running AddDescriptors() at dynamic initialization time.
-static bool dynamic_init_dummy_plugin_2eproto = (  ::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_plugin_2eproto), true);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_plugin_2eproto(&descriptor_table_plugin_2eproto);
 namespace proto {
 
 // ===================================================================
 
-void Job::InitAsDefaultInstance() {
-  ::proto::_Job_default_instance_._instance.get_mutable()->interaction_ = const_cast< ::proto::ManualInteraction*>(
-      ::proto::ManualInteraction::internal_default_instance());
-}
 class Job::_Internal {
  public:
   static const ::proto::ManualInteraction& interaction(const Job* msg);
@@ -226,128 +362,175 @@ class Job::_Internal {
 
 const ::proto::ManualInteraction&
 Job::_Internal::interaction(const Job* msg) {
-  return *msg->interaction_;
+  return *msg->_impl_.interaction_;
 }
-Job::Job()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:proto.Job)
+Job::Job(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto.Job)
 }
 Job::Job(const Job& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr),
-      dependson_(from.dependson_),
-      args_(from.args_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  title_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Job* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.dependson_){from._impl_.dependson_}
+    , /*decltype(_impl_._dependson_cached_byte_size_)*/{0}
+    , decltype(_impl_.args_){from._impl_.args_}
+    , decltype(_impl_.dependson64_){from._impl_.dependson64_}
+    , /*decltype(_impl_._dependson64_cached_byte_size_)*/{0}
+    , decltype(_impl_.title_){}
+    , decltype(_impl_.description_){}
+    , decltype(_impl_.interaction_){nullptr}
+    , decltype(_impl_.unique_id64_){}
+    , decltype(_impl_.unique_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.title_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.title_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_title().empty()) {
-    title_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.title_);
+    _this->_impl_.title_.Set(from._internal_title(), 
+      _this->GetArenaForAllocation());
   }
-  description_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.description_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.description_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_description().empty()) {
-    description_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.description_);
+    _this->_impl_.description_.Set(from._internal_description(), 
+      _this->GetArenaForAllocation());
   }
   if (from._internal_has_interaction()) {
-    interaction_ = new ::proto::ManualInteraction(*from.interaction_);
-  } else {
-    interaction_ = nullptr;
+    _this->_impl_.interaction_ = new ::proto::ManualInteraction(*from._impl_.interaction_);
   }
-  unique_id_ = from.unique_id_;
+  ::memcpy(&_impl_.unique_id64_, &from._impl_.unique_id64_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.unique_id_) -
+    reinterpret_cast<char*>(&_impl_.unique_id64_)) + sizeof(_impl_.unique_id_));
   // @@protoc_insertion_point(copy_constructor:proto.Job)
 }
 
-void Job::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Job_plugin_2eproto.base);
-  title_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  description_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&interaction_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&unique_id_) -
-      reinterpret_cast<char*>(&interaction_)) + sizeof(unique_id_));
+inline void Job::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.dependson_){arena}
+    , /*decltype(_impl_._dependson_cached_byte_size_)*/{0}
+    , decltype(_impl_.args_){arena}
+    , decltype(_impl_.dependson64_){arena}
+    , /*decltype(_impl_._dependson64_cached_byte_size_)*/{0}
+    , decltype(_impl_.title_){}
+    , decltype(_impl_.description_){}
+    , decltype(_impl_.interaction_){nullptr}
+    , decltype(_impl_.unique_id64_){uint64_t{0u}}
+    , decltype(_impl_.unique_id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.title_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.title_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.description_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.description_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Job::~Job() {
   // @@protoc_insertion_point(destructor:proto.Job)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Job::SharedDtor() {
-  title_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  description_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete interaction_;
+inline void Job::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.dependson_.~RepeatedField();
+  _impl_.args_.~RepeatedPtrField();
+  _impl_.dependson64_.~RepeatedField();
+  _impl_.title_.Destroy();
+  _impl_.description_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.interaction_;
 }
 
 void Job::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const Job& Job::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Job_plugin_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void Job::Clear() {
 // @@protoc_insertion_point(message_clear_start:proto.Job)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  dependson_.Clear();
-  args_.Clear();
-  title_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  description_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (GetArenaNoVirtual() == nullptr && interaction_ != nullptr) {
-    delete interaction_;
+  _impl_.dependson_.Clear();
+  _impl_.args_.Clear();
+  _impl_.dependson64_.Clear();
+  _impl_.title_.ClearToEmpty();
+  _impl_.description_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.interaction_ != nullptr) {
+    delete _impl_.interaction_;
   }
-  interaction_ = nullptr;
-  unique_id_ = 0u;
-  _internal_metadata_.Clear();
+  _impl_.interaction_ = nullptr;
+  ::memset(&_impl_.unique_id64_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.unique_id_) -
+      reinterpret_cast<char*>(&_impl_.unique_id64_)) + sizeof(_impl_.unique_id_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Job::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Job::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // uint32 unique_id = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          unique_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.unique_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // string title = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           auto str = _internal_mutable_title();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "proto.Job.title"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "proto.Job.title"));
+        } else
+          goto handle_unusual;
         continue;
       // string description = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
           auto str = _internal_mutable_description();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "proto.Job.description"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "proto.Job.description"));
+        } else
+          goto handle_unusual;
         continue;
       // repeated uint32 dependson = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
           ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_dependson(), ptr, ctx);
           CHK_(ptr);
-        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32) {
-          _internal_add_dependson(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+        } else if (static_cast<uint8_t>(tag) == 32) {
+          _internal_add_dependson(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // repeated .proto.Argument args = 5;
       case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
           ptr -= 1;
           do {
             ptr += 1;
@@ -355,49 +538,73 @@ const char* Job::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::intern
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .proto.ManualInteraction interaction = 6;
       case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
           ptr = ctx->ParseMessage(_internal_mutable_interaction(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+      // uint64 unique_id64 = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.unique_id64_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      // repeated uint64 dependson64 = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_dependson64(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 64) {
+          _internal_add_dependson64(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* Job::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* Job::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:proto.Job)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // uint32 unique_id = 1;
-  if (this->unique_id() != 0) {
+  if (this->_internal_unique_id() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(1, this->_internal_unique_id(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_unique_id(), target);
   }
 
   // string title = 2;
-  if (this->title().size() > 0) {
+  if (!this->_internal_title().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_title().data(), static_cast<int>(this->_internal_title().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -407,7 +614,7 @@ failure:
   }
 
   // string description = 3;
-  if (this->description().size() > 0) {
+  if (!this->_internal_description().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_description().data(), static_cast<int>(this->_internal_description().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -418,7 +625,7 @@ failure:
 
   // repeated uint32 dependson = 4;
   {
-    int byte_size = _dependson_cached_byte_size_.load(std::memory_order_relaxed);
+    int byte_size = _impl_._dependson_cached_byte_size_.load(std::memory_order_relaxed);
     if (byte_size > 0) {
       target = stream->WriteUInt32Packed(
           4, _internal_dependson(), byte_size, target);
@@ -426,24 +633,38 @@ failure:
   }
 
   // repeated .proto.Argument args = 5;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_args_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_args_size()); i < n; i++) {
+    const auto& repfield = this->_internal_args(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(5, this->_internal_args(i), target, stream);
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // .proto.ManualInteraction interaction = 6;
-  if (this->has_interaction()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_interaction()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        6, _Internal::interaction(this), target, stream);
+      InternalWriteMessage(6, _Internal::interaction(this),
+        _Internal::interaction(this).GetCachedSize(), target, stream);
+  }
+
+  // uint64 unique_id64 = 7;
+  if (this->_internal_unique_id64() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_unique_id64(), target);
+  }
+
+  // repeated uint64 dependson64 = 8;
+  {
+    int byte_size = _impl_._dependson64_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          8, _internal_dependson64(), byte_size, target);
+    }
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:proto.Job)
   return target;
@@ -453,114 +674,114 @@ size_t Job::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:proto.Job)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // repeated uint32 dependson = 4;
   {
-    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      UInt32Size(this->dependson_);
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.dependson_);
     if (data_size > 0) {
       total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
-    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
-    _dependson_cached_byte_size_.store(cached_size,
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._dependson_cached_byte_size_.store(cached_size,
                                     std::memory_order_relaxed);
     total_size += data_size;
   }
 
   // repeated .proto.Argument args = 5;
   total_size += 1UL * this->_internal_args_size();
-  for (const auto& msg : this->args_) {
+  for (const auto& msg : this->_impl_.args_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
+  // repeated uint64 dependson64 = 8;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.dependson64_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._dependson64_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
   // string title = 2;
-  if (this->title().size() > 0) {
+  if (!this->_internal_title().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_title());
   }
 
   // string description = 3;
-  if (this->description().size() > 0) {
+  if (!this->_internal_description().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_description());
   }
 
   // .proto.ManualInteraction interaction = 6;
-  if (this->has_interaction()) {
+  if (this->_internal_has_interaction()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *interaction_);
+        *_impl_.interaction_);
+  }
+
+  // uint64 unique_id64 = 7;
+  if (this->_internal_unique_id64() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_unique_id64());
   }
 
   // uint32 unique_id = 1;
-  if (this->unique_id() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->_internal_unique_id());
+  if (this->_internal_unique_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_unique_id());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void Job::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:proto.Job)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Job* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Job>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto.Job)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto.Job)
-    MergeFrom(*source);
-  }
-}
-
-void Job::MergeFrom(const Job& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:proto.Job)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
 
-  dependson_.MergeFrom(from.dependson_);
-  args_.MergeFrom(from.args_);
-  if (from.title().size() > 0) {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Job::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Job::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Job::GetClassData() const { return &_class_data_; }
 
-    title_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.title_);
-  }
-  if (from.description().size() > 0) {
 
-    description_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.description_);
+void Job::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Job*>(&to_msg);
+  auto& from = static_cast<const Job&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto.Job)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.dependson_.MergeFrom(from._impl_.dependson_);
+  _this->_impl_.args_.MergeFrom(from._impl_.args_);
+  _this->_impl_.dependson64_.MergeFrom(from._impl_.dependson64_);
+  if (!from._internal_title().empty()) {
+    _this->_internal_set_title(from._internal_title());
   }
-  if (from.has_interaction()) {
-    _internal_mutable_interaction()->::proto::ManualInteraction::MergeFrom(from._internal_interaction());
+  if (!from._internal_description().empty()) {
+    _this->_internal_set_description(from._internal_description());
   }
-  if (from.unique_id() != 0) {
-    _internal_set_unique_id(from._internal_unique_id());
+  if (from._internal_has_interaction()) {
+    _this->_internal_mutable_interaction()->::proto::ManualInteraction::MergeFrom(
+        from._internal_interaction());
   }
-}
-
-void Job::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:proto.Job)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_unique_id64() != 0) {
+    _this->_internal_set_unique_id64(from._internal_unique_id64());
+  }
+  if (from._internal_unique_id() != 0) {
+    _this->_internal_set_unique_id(from._internal_unique_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Job::CopyFrom(const Job& from) {
@@ -576,171 +797,232 @@ bool Job::IsInitialized() const {
 
 void Job::InternalSwap(Job* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  dependson_.InternalSwap(&other->dependson_);
-  args_.InternalSwap(&other->args_);
-  title_.Swap(&other->title_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  description_.Swap(&other->description_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(interaction_, other->interaction_);
-  swap(unique_id_, other->unique_id_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.dependson_.InternalSwap(&other->_impl_.dependson_);
+  _impl_.args_.InternalSwap(&other->_impl_.args_);
+  _impl_.dependson64_.InternalSwap(&other->_impl_.dependson64_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.title_, lhs_arena,
+      &other->_impl_.title_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.description_, lhs_arena,
+      &other->_impl_.description_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Job, _impl_.unique_id_)
+      + sizeof(Job::_impl_.unique_id_)
+      - PROTOBUF_FIELD_OFFSET(Job, _impl_.interaction_)>(
+          reinterpret_cast<char*>(&_impl_.interaction_),
+          reinterpret_cast<char*>(&other->_impl_.interaction_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Job::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_plugin_2eproto_getter, &descriptor_table_plugin_2eproto_once,
+      file_level_metadata_plugin_2eproto[0]);
 }
 
-
 // ===================================================================
 
-void Argument::InitAsDefaultInstance() {
-}
 class Argument::_Internal {
  public:
 };
 
-Argument::Argument()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:proto.Argument)
+Argument::Argument(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto.Argument)
 }
 Argument::Argument(const Argument& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  description_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Argument* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.description_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.description_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.description_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_description().empty()) {
-    description_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.description_);
+    _this->_impl_.description_.Set(from._internal_description(), 
+      _this->GetArenaForAllocation());
   }
-  type_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_type().empty()) {
-    type_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.type_);
+    _this->_impl_.type_.Set(from._internal_type(), 
+      _this->GetArenaForAllocation());
   }
-  key_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_key().empty()) {
-    key_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.key_);
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
   }
-  value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_value().empty()) {
-    value_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.value_);
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:proto.Argument)
 }
 
-void Argument::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Argument_plugin_2eproto.base);
-  description_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  type_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  key_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void Argument::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.description_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.description_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.description_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Argument::~Argument() {
   // @@protoc_insertion_point(destructor:proto.Argument)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Argument::SharedDtor() {
-  description_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  type_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  key_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  value_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void Argument::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.description_.Destroy();
+  _impl_.type_.Destroy();
+  _impl_.key_.Destroy();
+  _impl_.value_.Destroy();
 }
 
 void Argument::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Argument& Argument::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Argument_plugin_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void Argument::Clear() {
 // @@protoc_insertion_point(message_clear_start:proto.Argument)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  description_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  type_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  key_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  value_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _internal_metadata_.Clear();
+  _impl_.description_.ClearToEmpty();
+  _impl_.type_.ClearToEmpty();
+  _impl_.key_.ClearToEmpty();
+  _impl_.value_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Argument::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Argument::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string description = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_description();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "proto.Argument.description"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "proto.Argument.description"));
+        } else
+          goto handle_unusual;
         continue;
       // string type = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           auto str = _internal_mutable_type();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "proto.Argument.type"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "proto.Argument.type"));
+        } else
+          goto handle_unusual;
         continue;
       // string key = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
           auto str = _internal_mutable_key();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "proto.Argument.key"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "proto.Argument.key"));
+        } else
+          goto handle_unusual;
         continue;
       // string value = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
           auto str = _internal_mutable_value();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "proto.Argument.value"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+          CHK_(::_pbi::VerifyUTF8(str, "proto.Argument.value"));
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* Argument::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* Argument::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:proto.Argument)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string description = 1;
-  if (this->description().size() > 0) {
+  if (!this->_internal_description().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_description().data(), static_cast<int>(this->_internal_description().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -750,7 +1032,7 @@ failure:
   }
 
   // string type = 2;
-  if (this->type().size() > 0) {
+  if (!this->_internal_type().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_type().data(), static_cast<int>(this->_internal_type().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -760,7 +1042,7 @@ failure:
   }
 
   // string key = 3;
-  if (this->key().size() > 0) {
+  if (!this->_internal_key().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_key().data(), static_cast<int>(this->_internal_key().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -770,7 +1052,7 @@ failure:
   }
 
   // string value = 4;
-  if (this->value().size() > 0) {
+  if (!this->_internal_value().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_value().data(), static_cast<int>(this->_internal_value().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -780,8 +1062,8 @@ failure:
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:proto.Argument)
   return target;
@@ -791,92 +1073,69 @@ size_t Argument::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:proto.Argument)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string description = 1;
-  if (this->description().size() > 0) {
+  if (!this->_internal_description().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_description());
   }
 
   // string type = 2;
-  if (this->type().size() > 0) {
+  if (!this->_internal_type().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_type());
   }
 
   // string key = 3;
-  if (this->key().size() > 0) {
+  if (!this->_internal_key().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_key());
   }
 
   // string value = 4;
-  if (this->value().size() > 0) {
+  if (!this->_internal_value().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_value());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void Argument::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:proto.Argument)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Argument* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Argument>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto.Argument)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto.Argument)
-    MergeFrom(*source);
-  }
-}
-
-void Argument::MergeFrom(const Argument& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:proto.Argument)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Argument::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Argument::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Argument::GetClassData() const { return &_class_data_; }
 
-  if (from.description().size() > 0) {
 
-    description_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.description_);
-  }
-  if (from.type().size() > 0) {
+void Argument::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Argument*>(&to_msg);
+  auto& from = static_cast<const Argument&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto.Argument)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    type_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.type_);
+  if (!from._internal_description().empty()) {
+    _this->_internal_set_description(from._internal_description());
   }
-  if (from.key().size() > 0) {
-
-    key_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.key_);
+  if (!from._internal_type().empty()) {
+    _this->_internal_set_type(from._internal_type());
   }
-  if (from.value().size() > 0) {
-
-    value_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.value_);
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
   }
-}
-
-void Argument::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:proto.Argument)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Argument::CopyFrom(const Argument& from) {
@@ -892,155 +1151,450 @@ bool Argument::IsInitialized() const {
 
 void Argument::InternalSwap(Argument* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  description_.Swap(&other->description_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  type_.Swap(&other->type_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  key_.Swap(&other->key_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  value_.Swap(&other->value_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.description_, lhs_arena,
+      &other->_impl_.description_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.type_, lhs_arena,
+      &other->_impl_.type_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Argument::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_plugin_2eproto_getter, &descriptor_table_plugin_2eproto_once,
+      file_level_metadata_plugin_2eproto[1]);
 }
 
-
 // ===================================================================
 
-void ManualInteraction::InitAsDefaultInstance() {
+class ExecuteRequest::_Internal {
+ public:
+};
+
+ExecuteRequest::ExecuteRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto.ExecuteRequest)
+}
+ExecuteRequest::ExecuteRequest(const ExecuteRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ExecuteRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.args_){from._impl_.args_}
+    , decltype(_impl_.unique_id64_){}
+    , decltype(_impl_.unique_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.unique_id64_, &from._impl_.unique_id64_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.unique_id_) -
+    reinterpret_cast<char*>(&_impl_.unique_id64_)) + sizeof(_impl_.unique_id_));
+  // @@protoc_insertion_point(copy_constructor:proto.ExecuteRequest)
+}
+
+inline void ExecuteRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.args_){arena}
+    , decltype(_impl_.unique_id64_){uint64_t{0u}}
+    , decltype(_impl_.unique_id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ExecuteRequest::~ExecuteRequest() {
+  // @@protoc_insertion_point(destructor:proto.ExecuteRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ExecuteRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.args_.~RepeatedPtrField();
+}
+
+void ExecuteRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ExecuteRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto.ExecuteRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.args_.Clear();
+  ::memset(&_impl_.unique_id64_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.unique_id_) -
+      reinterpret_cast<char*>(&_impl_.unique_id64_)) + sizeof(_impl_.unique_id_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ExecuteRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 unique_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.unique_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .proto.Argument args = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_args(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 unique_id64 = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.unique_id64_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ExecuteRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto.ExecuteRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 unique_id = 1;
+  if (this->_internal_unique_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_unique_id(), target);
+  }
+
+  // repeated .proto.Argument args = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_args_size()); i < n; i++) {
+    const auto& repfield = this->_internal_args(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // uint64 unique_id64 = 7;
+  if (this->_internal_unique_id64() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_unique_id64(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto.ExecuteRequest)
+  return target;
+}
+
+size_t ExecuteRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto.ExecuteRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .proto.Argument args = 5;
+  total_size += 1UL * this->_internal_args_size();
+  for (const auto& msg : this->_impl_.args_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // uint64 unique_id64 = 7;
+  if (this->_internal_unique_id64() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_unique_id64());
+  }
+
+  // uint32 unique_id = 1;
+  if (this->_internal_unique_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_unique_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ExecuteRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ExecuteRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ExecuteRequest::GetClassData() const { return &_class_data_; }
+
+
+void ExecuteRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ExecuteRequest*>(&to_msg);
+  auto& from = static_cast<const ExecuteRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto.ExecuteRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.args_.MergeFrom(from._impl_.args_);
+  if (from._internal_unique_id64() != 0) {
+    _this->_internal_set_unique_id64(from._internal_unique_id64());
+  }
+  if (from._internal_unique_id() != 0) {
+    _this->_internal_set_unique_id(from._internal_unique_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ExecuteRequest::CopyFrom(const ExecuteRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto.ExecuteRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ExecuteRequest::IsInitialized() const {
+  return true;
+}
+
+void ExecuteRequest::InternalSwap(ExecuteRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.args_.InternalSwap(&other->_impl_.args_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ExecuteRequest, _impl_.unique_id_)
+      + sizeof(ExecuteRequest::_impl_.unique_id_)
+      - PROTOBUF_FIELD_OFFSET(ExecuteRequest, _impl_.unique_id64_)>(
+          reinterpret_cast<char*>(&_impl_.unique_id64_),
+          reinterpret_cast<char*>(&other->_impl_.unique_id64_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ExecuteRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_plugin_2eproto_getter, &descriptor_table_plugin_2eproto_once,
+      file_level_metadata_plugin_2eproto[2]);
 }
+
+// ===================================================================
+
 class ManualInteraction::_Internal {
  public:
 };
 
-ManualInteraction::ManualInteraction()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:proto.ManualInteraction)
+ManualInteraction::ManualInteraction(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto.ManualInteraction)
 }
 ManualInteraction::ManualInteraction(const ManualInteraction& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  description_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ManualInteraction* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.description_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.description_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.description_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_description().empty()) {
-    description_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.description_);
+    _this->_impl_.description_.Set(from._internal_description(), 
+      _this->GetArenaForAllocation());
   }
-  type_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_type().empty()) {
-    type_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.type_);
+    _this->_impl_.type_.Set(from._internal_type(), 
+      _this->GetArenaForAllocation());
   }
-  value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_value().empty()) {
-    value_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.value_);
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:proto.ManualInteraction)
 }
 
-void ManualInteraction::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_ManualInteraction_plugin_2eproto.base);
-  description_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  type_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void ManualInteraction::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.description_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.description_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.description_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 ManualInteraction::~ManualInteraction() {
   // @@protoc_insertion_point(destructor:proto.ManualInteraction)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void ManualInteraction::SharedDtor() {
-  description_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  type_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  value_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void ManualInteraction::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.description_.Destroy();
+  _impl_.type_.Destroy();
+  _impl_.value_.Destroy();
 }
 
 void ManualInteraction::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const ManualInteraction& ManualInteraction::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_ManualInteraction_plugin_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void ManualInteraction::Clear() {
 // @@protoc_insertion_point(message_clear_start:proto.ManualInteraction)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  description_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  type_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  value_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _internal_metadata_.Clear();
+  _impl_.description_.ClearToEmpty();
+  _impl_.type_.ClearToEmpty();
+  _impl_.value_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ManualInteraction::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* ManualInteraction::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string description = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_description();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "proto.ManualInteraction.description"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "proto.ManualInteraction.description"));
+        } else
+          goto handle_unusual;
         continue;
       // string type = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           auto str = _internal_mutable_type();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "proto.ManualInteraction.type"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "proto.ManualInteraction.type"));
+        } else
+          goto handle_unusual;
         continue;
       // string value = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
           auto str = _internal_mutable_value();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "proto.ManualInteraction.value"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "proto.ManualInteraction.value"));
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* ManualInteraction::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* ManualInteraction::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:proto.ManualInteraction)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string description = 1;
-  if (this->description().size() > 0) {
+  if (!this->_internal_description().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_description().data(), static_cast<int>(this->_internal_description().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -1050,7 +1604,7 @@ failure:
   }
 
   // string type = 2;
-  if (this->type().size() > 0) {
+  if (!this->_internal_type().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_type().data(), static_cast<int>(this->_internal_type().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -1060,7 +1614,7 @@ failure:
   }
 
   // string value = 3;
-  if (this->value().size() > 0) {
+  if (!this->_internal_value().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_value().data(), static_cast<int>(this->_internal_value().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -1070,8 +1624,8 @@ failure:
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:proto.ManualInteraction)
   return target;
@@ -1081,81 +1635,59 @@ size_t ManualInteraction::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:proto.ManualInteraction)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string description = 1;
-  if (this->description().size() > 0) {
+  if (!this->_internal_description().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_description());
   }
 
   // string type = 2;
-  if (this->type().size() > 0) {
+  if (!this->_internal_type().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_type());
   }
 
   // string value = 3;
-  if (this->value().size() > 0) {
+  if (!this->_internal_value().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_value());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void ManualInteraction::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:proto.ManualInteraction)
-  GOOGLE_DCHECK_NE(&from, this);
-  const ManualInteraction* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<ManualInteraction>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto.ManualInteraction)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto.ManualInteraction)
-    MergeFrom(*source);
-  }
-}
-
-void ManualInteraction::MergeFrom(const ManualInteraction& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:proto.ManualInteraction)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
 
-  if (from.description().size() > 0) {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ManualInteraction::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ManualInteraction::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ManualInteraction::GetClassData() const { return &_class_data_; }
 
-    description_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.description_);
-  }
-  if (from.type().size() > 0) {
 
-    type_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.type_);
-  }
-  if (from.value().size() > 0) {
+void ManualInteraction::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ManualInteraction*>(&to_msg);
+  auto& from = static_cast<const ManualInteraction&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto.ManualInteraction)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    value_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.value_);
+  if (!from._internal_description().empty()) {
+    _this->_internal_set_description(from._internal_description());
   }
-}
-
-void ManualInteraction::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:proto.ManualInteraction)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (!from._internal_type().empty()) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void ManualInteraction::CopyFrom(const ManualInteraction& from) {
@@ -1171,169 +1703,213 @@ bool ManualInteraction::IsInitialized() const {
 
 void ManualInteraction::InternalSwap(ManualInteraction* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  description_.Swap(&other->description_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  type_.Swap(&other->type_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  value_.Swap(&other->value_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.description_, lhs_arena,
+      &other->_impl_.description_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.type_, lhs_arena,
+      &other->_impl_.type_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata ManualInteraction::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_plugin_2eproto_getter, &descriptor_table_plugin_2eproto_once,
+      file_level_metadata_plugin_2eproto[3]);
 }
 
-
 // ===================================================================
 
-void JobResult::InitAsDefaultInstance() {
-}
 class JobResult::_Internal {
  public:
 };
 
-JobResult::JobResult()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:proto.JobResult)
+JobResult::JobResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto.JobResult)
 }
 JobResult::JobResult(const JobResult& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  message_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  JobResult* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.message_){}
+    , decltype(_impl_.unique_id_){}
+    , decltype(_impl_.failed_){}
+    , decltype(_impl_.exit_pipeline_){}
+    , decltype(_impl_.unique_id64_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_message().empty()) {
-    message_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.message_);
+    _this->_impl_.message_.Set(from._internal_message(), 
+      _this->GetArenaForAllocation());
   }
-  ::memcpy(&unique_id_, &from.unique_id_,
-    static_cast<size_t>(reinterpret_cast<char*>(&exit_pipeline_) -
-    reinterpret_cast<char*>(&unique_id_)) + sizeof(exit_pipeline_));
+  ::memcpy(&_impl_.unique_id_, &from._impl_.unique_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.unique_id64_) -
+    reinterpret_cast<char*>(&_impl_.unique_id_)) + sizeof(_impl_.unique_id64_));
   // @@protoc_insertion_point(copy_constructor:proto.JobResult)
 }
 
-void JobResult::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_JobResult_plugin_2eproto.base);
-  message_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&unique_id_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&exit_pipeline_) -
-      reinterpret_cast<char*>(&unique_id_)) + sizeof(exit_pipeline_));
+inline void JobResult::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.message_){}
+    , decltype(_impl_.unique_id_){0u}
+    , decltype(_impl_.failed_){false}
+    , decltype(_impl_.exit_pipeline_){false}
+    , decltype(_impl_.unique_id64_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 JobResult::~JobResult() {
   // @@protoc_insertion_point(destructor:proto.JobResult)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void JobResult::SharedDtor() {
-  message_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void JobResult::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.message_.Destroy();
 }
 
 void JobResult::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const JobResult& JobResult::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_JobResult_plugin_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void JobResult::Clear() {
 // @@protoc_insertion_point(message_clear_start:proto.JobResult)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  message_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&unique_id_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&exit_pipeline_) -
-      reinterpret_cast<char*>(&unique_id_)) + sizeof(exit_pipeline_));
-  _internal_metadata_.Clear();
+  _impl_.message_.ClearToEmpty();
+  ::memset(&_impl_.unique_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.unique_id64_) -
+      reinterpret_cast<char*>(&_impl_.unique_id_)) + sizeof(_impl_.unique_id64_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* JobResult::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* JobResult::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // uint32 unique_id = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          unique_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.unique_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // bool failed = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          failed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.failed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // bool exit_pipeline = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          exit_pipeline_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.exit_pipeline_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // string message = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
           auto str = _internal_mutable_message();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "proto.JobResult.message"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "proto.JobResult.message"));
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+      // uint64 unique_id64 = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.unique_id64_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* JobResult::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* JobResult::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:proto.JobResult)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // uint32 unique_id = 1;
-  if (this->unique_id() != 0) {
+  if (this->_internal_unique_id() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(1, this->_internal_unique_id(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_unique_id(), target);
   }
 
   // bool failed = 2;
-  if (this->failed() != 0) {
+  if (this->_internal_failed() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(2, this->_internal_failed(), target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_failed(), target);
   }
 
   // bool exit_pipeline = 3;
-  if (this->exit_pipeline() != 0) {
+  if (this->_internal_exit_pipeline() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(3, this->_internal_exit_pipeline(), target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_exit_pipeline(), target);
   }
 
   // string message = 4;
-  if (this->message().size() > 0) {
+  if (!this->_internal_message().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_message().data(), static_cast<int>(this->_internal_message().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -1342,9 +1918,15 @@ failure:
         4, this->_internal_message(), target);
   }
 
+  // uint64 unique_id64 = 5;
+  if (this->_internal_unique_id64() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_unique_id64(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:proto.JobResult)
   return target;
@@ -1354,85 +1936,71 @@ size_t JobResult::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:proto.JobResult)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string message = 4;
-  if (this->message().size() > 0) {
+  if (!this->_internal_message().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_message());
   }
 
   // uint32 unique_id = 1;
-  if (this->unique_id() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->_internal_unique_id());
+  if (this->_internal_unique_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_unique_id());
   }
 
   // bool failed = 2;
-  if (this->failed() != 0) {
+  if (this->_internal_failed() != 0) {
     total_size += 1 + 1;
   }
 
   // bool exit_pipeline = 3;
-  if (this->exit_pipeline() != 0) {
+  if (this->_internal_exit_pipeline() != 0) {
     total_size += 1 + 1;
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void JobResult::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:proto.JobResult)
-  GOOGLE_DCHECK_NE(&from, this);
-  const JobResult* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<JobResult>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto.JobResult)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto.JobResult)
-    MergeFrom(*source);
-  }
-}
-
-void JobResult::MergeFrom(const JobResult& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:proto.JobResult)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+  // uint64 unique_id64 = 5;
+  if (this->_internal_unique_id64() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_unique_id64());
+  }
 
-  if (from.message().size() > 0) {
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
 
-    message_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.message_);
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData JobResult::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    JobResult::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*JobResult::GetClassData() const { return &_class_data_; }
+
+
+void JobResult::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<JobResult*>(&to_msg);
+  auto& from = static_cast<const JobResult&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto.JobResult)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_message().empty()) {
+    _this->_internal_set_message(from._internal_message());
   }
-  if (from.unique_id() != 0) {
-    _internal_set_unique_id(from._internal_unique_id());
+  if (from._internal_unique_id() != 0) {
+    _this->_internal_set_unique_id(from._internal_unique_id());
   }
-  if (from.failed() != 0) {
-    _internal_set_failed(from._internal_failed());
+  if (from._internal_failed() != 0) {
+    _this->_internal_set_failed(from._internal_failed());
   }
-  if (from.exit_pipeline() != 0) {
-    _internal_set_exit_pipeline(from._internal_exit_pipeline());
+  if (from._internal_exit_pipeline() != 0) {
+    _this->_internal_set_exit_pipeline(from._internal_exit_pipeline());
   }
-}
-
-void JobResult::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:proto.JobResult)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_unique_id64() != 0) {
+    _this->_internal_set_unique_id64(from._internal_unique_id64());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void JobResult::CopyFrom(const JobResult& from) {
@@ -1448,190 +2016,1131 @@ bool JobResult::IsInitialized() const {
 
 void JobResult::InternalSwap(JobResult* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  message_.Swap(&other->message_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(unique_id_, other->unique_id_);
-  swap(failed_, other->failed_);
-  swap(exit_pipeline_, other->exit_pipeline_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.message_, lhs_arena,
+      &other->_impl_.message_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(JobResult, _impl_.unique_id64_)
+      + sizeof(JobResult::_impl_.unique_id64_)
+      - PROTOBUF_FIELD_OFFSET(JobResult, _impl_.unique_id_)>(
+          reinterpret_cast<char*>(&_impl_.unique_id_),
+          reinterpret_cast<char*>(&other->_impl_.unique_id_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata JobResult::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_plugin_2eproto_getter, &descriptor_table_plugin_2eproto_once,
+      file_level_metadata_plugin_2eproto[4]);
 }
 
-
 // ===================================================================
 
-void Empty::InitAsDefaultInstance() {
+class JobOutput::_Internal {
+ public:
+  static const ::proto::JobResult& result(const JobOutput* msg);
+};
+
+const ::proto::JobResult&
+JobOutput::_Internal::result(const JobOutput* msg) {
+  return *msg->_impl_.output_.result_;
+}
+void JobOutput::set_allocated_result(::proto::JobResult* result) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_output();
+  if (result) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(result);
+    if (message_arena != submessage_arena) {
+      result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, result, submessage_arena);
+    }
+    set_has_result();
+    _impl_.output_.result_ = result;
+  }
+  // @@protoc_insertion_point(field_set_allocated:proto.JobOutput.result)
+}
+JobOutput::JobOutput(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto.JobOutput)
+}
+JobOutput::JobOutput(const JobOutput& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  JobOutput* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.output_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  clear_has_output();
+  switch (from.output_case()) {
+    case kLog: {
+      _this->_internal_set_log(from._internal_log());
+      break;
+    }
+    case kResult: {
+      _this->_internal_mutable_result()->::proto::JobResult::MergeFrom(
+          from._internal_result());
+      break;
+    }
+    case OUTPUT_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:proto.JobOutput)
+}
+
+inline void JobOutput::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.output_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_output();
 }
-class Empty::_Internal {
+
+JobOutput::~JobOutput() {
+  // @@protoc_insertion_point(destructor:proto.JobOutput)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void JobOutput::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_output()) {
+    clear_output();
+  }
+}
+
+void JobOutput::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void JobOutput::clear_output() {
+// @@protoc_insertion_point(one_of_clear_start:proto.JobOutput)
+  switch (output_case()) {
+    case kLog: {
+      _impl_.output_.log_.Destroy();
+      break;
+    }
+    case kResult: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.output_.result_;
+      }
+      break;
+    }
+    case OUTPUT_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = OUTPUT_NOT_SET;
+}
+
+
+void JobOutput::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto.JobOutput)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  clear_output();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* JobOutput::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes log = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_log();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .proto.JobResult result = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_result(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* JobOutput::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto.JobOutput)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes log = 1;
+  if (_internal_has_log()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_log(), target);
+  }
+
+  // .proto.JobResult result = 2;
+  if (_internal_has_result()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::result(this),
+        _Internal::result(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto.JobOutput)
+  return target;
+}
+
+size_t JobOutput::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto.JobOutput)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  switch (output_case()) {
+    // bytes log = 1;
+    case kLog: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_log());
+      break;
+    }
+    // .proto.JobResult result = 2;
+    case kResult: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.output_.result_);
+      break;
+    }
+    case OUTPUT_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData JobOutput::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    JobOutput::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*JobOutput::GetClassData() const { return &_class_data_; }
+
+
+void JobOutput::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<JobOutput*>(&to_msg);
+  auto& from = static_cast<const JobOutput&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto.JobOutput)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (from.output_case()) {
+    case kLog: {
+      _this->_internal_set_log(from._internal_log());
+      break;
+    }
+    case kResult: {
+      _this->_internal_mutable_result()->::proto::JobResult::MergeFrom(
+          from._internal_result());
+      break;
+    }
+    case OUTPUT_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void JobOutput::CopyFrom(const JobOutput& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto.JobOutput)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool JobOutput::IsInitialized() const {
+  return true;
+}
+
+void JobOutput::InternalSwap(JobOutput* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.output_, other->_impl_.output_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata JobOutput::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_plugin_2eproto_getter, &descriptor_table_plugin_2eproto_once,
+      file_level_metadata_plugin_2eproto[5]);
+}
+
+// ===================================================================
+
+class JobBatch::_Internal {
  public:
 };
 
-Empty::Empty()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:proto.Empty)
+JobBatch::JobBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto.JobBatch)
 }
-Empty::Empty(const Empty& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:proto.Empty)
+JobBatch::JobBatch(const JobBatch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  JobBatch* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.jobs_){from._impl_.jobs_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:proto.JobBatch)
 }
 
-void Empty::SharedCtor() {
+inline void JobBatch::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.jobs_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-Empty::~Empty() {
-  // @@protoc_insertion_point(destructor:proto.Empty)
+JobBatch::~JobBatch() {
+  // @@protoc_insertion_point(destructor:proto.JobBatch)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Empty::SharedDtor() {
+inline void JobBatch::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.jobs_.~RepeatedPtrField();
 }
 
-void Empty::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+void JobBatch::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
-const Empty& Empty::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Empty_plugin_2eproto.base);
-  return *internal_default_instance();
+
+void JobBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto.JobBatch)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.jobs_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
+const char* JobBatch::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .proto.Job jobs = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_jobs(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* JobBatch::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto.JobBatch)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void Empty::Clear() {
-// @@protoc_insertion_point(message_clear_start:proto.Empty)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // repeated .proto.Job jobs = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_jobs_size()); i < n; i++) {
+    const auto& repfield = this->_internal_jobs(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto.JobBatch)
+  return target;
+}
+
+size_t JobBatch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto.JobBatch)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _internal_metadata_.Clear();
+  // repeated .proto.Job jobs = 1;
+  total_size += 1UL * this->_internal_jobs_size();
+  for (const auto& msg : this->_impl_.jobs_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData JobBatch::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    JobBatch::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*JobBatch::GetClassData() const { return &_class_data_; }
+
+
+void JobBatch::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<JobBatch*>(&to_msg);
+  auto& from = static_cast<const JobBatch&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto.JobBatch)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.jobs_.MergeFrom(from._impl_.jobs_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-const char* Empty::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+void JobBatch::CopyFrom(const JobBatch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto.JobBatch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool JobBatch::IsInitialized() const {
+  return true;
+}
+
+void JobBatch::InternalSwap(JobBatch* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.jobs_.InternalSwap(&other->_impl_.jobs_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata JobBatch::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_plugin_2eproto_getter, &descriptor_table_plugin_2eproto_once,
+      file_level_metadata_plugin_2eproto[6]);
+}
+
+// ===================================================================
+
+class SessionRequest::_Internal {
+ public:
+  static const ::proto::ExecuteRequest& execute(const SessionRequest* msg);
+};
+
+const ::proto::ExecuteRequest&
+SessionRequest::_Internal::execute(const SessionRequest* msg) {
+  return *msg->_impl_.execute_;
+}
+SessionRequest::SessionRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto.SessionRequest)
+}
+SessionRequest::SessionRequest(const SessionRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SessionRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.execute_){nullptr}
+    , decltype(_impl_.correlation_id_){}
+    , decltype(_impl_.cancel_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_execute()) {
+    _this->_impl_.execute_ = new ::proto::ExecuteRequest(*from._impl_.execute_);
+  }
+  ::memcpy(&_impl_.correlation_id_, &from._impl_.correlation_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.cancel_) -
+    reinterpret_cast<char*>(&_impl_.correlation_id_)) + sizeof(_impl_.cancel_));
+  // @@protoc_insertion_point(copy_constructor:proto.SessionRequest)
+}
+
+inline void SessionRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.execute_){nullptr}
+    , decltype(_impl_.correlation_id_){uint64_t{0u}}
+    , decltype(_impl_.cancel_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SessionRequest::~SessionRequest() {
+  // @@protoc_insertion_point(destructor:proto.SessionRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SessionRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.execute_;
+}
+
+void SessionRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SessionRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto.SessionRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.execute_ != nullptr) {
+    delete _impl_.execute_;
+  }
+  _impl_.execute_ = nullptr;
+  ::memset(&_impl_.correlation_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.cancel_) -
+      reinterpret_cast<char*>(&_impl_.correlation_id_)) + sizeof(_impl_.cancel_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SessionRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 correlation_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.correlation_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .proto.ExecuteRequest execute = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_execute(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool cancel = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.cancel_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* Empty::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:proto.Empty)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* SessionRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto.SessionRequest)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
+  // uint64 correlation_id = 1;
+  if (this->_internal_correlation_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_correlation_id(), target);
+  }
+
+  // .proto.ExecuteRequest execute = 2;
+  if (this->_internal_has_execute()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::execute(this),
+        _Internal::execute(this).GetCachedSize(), target, stream);
+  }
+
+  // bool cancel = 3;
+  if (this->_internal_cancel() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_cancel(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:proto.Empty)
+  // @@protoc_insertion_point(serialize_to_array_end:proto.SessionRequest)
   return target;
 }
 
-size_t Empty::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:proto.Empty)
+size_t SessionRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto.SessionRequest)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void Empty::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:proto.Empty)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Empty* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Empty>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:proto.Empty)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:proto.Empty)
-    MergeFrom(*source);
-  }
-}
-
-void Empty::MergeFrom(const Empty& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:proto.Empty)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // .proto.ExecuteRequest execute = 2;
+  if (this->_internal_has_execute()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.execute_);
+  }
+
+  // uint64 correlation_id = 1;
+  if (this->_internal_correlation_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_correlation_id());
+  }
+
+  // bool cancel = 3;
+  if (this->_internal_cancel() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SessionRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SessionRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SessionRequest::GetClassData() const { return &_class_data_; }
+
+
+void SessionRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SessionRequest*>(&to_msg);
+  auto& from = static_cast<const SessionRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto.SessionRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
+  if (from._internal_has_execute()) {
+    _this->_internal_mutable_execute()->::proto::ExecuteRequest::MergeFrom(
+        from._internal_execute());
+  }
+  if (from._internal_correlation_id() != 0) {
+    _this->_internal_set_correlation_id(from._internal_correlation_id());
+  }
+  if (from._internal_cancel() != 0) {
+    _this->_internal_set_cancel(from._internal_cancel());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Empty::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:proto.Empty)
+void SessionRequest::CopyFrom(const SessionRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto.SessionRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void Empty::CopyFrom(const Empty& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:proto.Empty)
+bool SessionRequest::IsInitialized() const {
+  return true;
+}
+
+void SessionRequest::InternalSwap(SessionRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SessionRequest, _impl_.cancel_)
+      + sizeof(SessionRequest::_impl_.cancel_)
+      - PROTOBUF_FIELD_OFFSET(SessionRequest, _impl_.execute_)>(
+          reinterpret_cast<char*>(&_impl_.execute_),
+          reinterpret_cast<char*>(&other->_impl_.execute_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SessionRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_plugin_2eproto_getter, &descriptor_table_plugin_2eproto_once,
+      file_level_metadata_plugin_2eproto[7]);
+}
+
+// ===================================================================
+
+class SessionResult::_Internal {
+ public:
+  static const ::proto::JobResult& result(const SessionResult* msg);
+};
+
+const ::proto::JobResult&
+SessionResult::_Internal::result(const SessionResult* msg) {
+  return *msg->_impl_.result_;
+}
+SessionResult::SessionResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto.SessionResult)
+}
+SessionResult::SessionResult(const SessionResult& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SessionResult* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.status_message_){}
+    , decltype(_impl_.result_){nullptr}
+    , decltype(_impl_.correlation_id_){}
+    , decltype(_impl_.status_code_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.status_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.status_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_status_message().empty()) {
+    _this->_impl_.status_message_.Set(from._internal_status_message(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_result()) {
+    _this->_impl_.result_ = new ::proto::JobResult(*from._impl_.result_);
+  }
+  ::memcpy(&_impl_.correlation_id_, &from._impl_.correlation_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.status_code_) -
+    reinterpret_cast<char*>(&_impl_.correlation_id_)) + sizeof(_impl_.status_code_));
+  // @@protoc_insertion_point(copy_constructor:proto.SessionResult)
+}
+
+inline void SessionResult::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.status_message_){}
+    , decltype(_impl_.result_){nullptr}
+    , decltype(_impl_.correlation_id_){uint64_t{0u}}
+    , decltype(_impl_.status_code_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.status_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.status_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SessionResult::~SessionResult() {
+  // @@protoc_insertion_point(destructor:proto.SessionResult)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SessionResult::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.status_message_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.result_;
+}
+
+void SessionResult::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SessionResult::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto.SessionResult)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.status_message_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.result_ != nullptr) {
+    delete _impl_.result_;
+  }
+  _impl_.result_ = nullptr;
+  ::memset(&_impl_.correlation_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.status_code_) -
+      reinterpret_cast<char*>(&_impl_.correlation_id_)) + sizeof(_impl_.status_code_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SessionResult::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 correlation_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.correlation_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .proto.JobResult result = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_result(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 status_code = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.status_code_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string status_message = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_status_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "proto.SessionResult.status_message"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SessionResult::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto.SessionResult)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 correlation_id = 1;
+  if (this->_internal_correlation_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_correlation_id(), target);
+  }
+
+  // .proto.JobResult result = 2;
+  if (this->_internal_has_result()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::result(this),
+        _Internal::result(this).GetCachedSize(), target, stream);
+  }
+
+  // int32 status_code = 3;
+  if (this->_internal_status_code() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_status_code(), target);
+  }
+
+  // string status_message = 4;
+  if (!this->_internal_status_message().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_status_message().data(), static_cast<int>(this->_internal_status_message().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proto.SessionResult.status_message");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_status_message(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto.SessionResult)
+  return target;
+}
+
+size_t SessionResult::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto.SessionResult)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string status_message = 4;
+  if (!this->_internal_status_message().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_status_message());
+  }
+
+  // .proto.JobResult result = 2;
+  if (this->_internal_has_result()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.result_);
+  }
+
+  // uint64 correlation_id = 1;
+  if (this->_internal_correlation_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_correlation_id());
+  }
+
+  // int32 status_code = 3;
+  if (this->_internal_status_code() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_status_code());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SessionResult::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SessionResult::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SessionResult::GetClassData() const { return &_class_data_; }
+
+
+void SessionResult::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SessionResult*>(&to_msg);
+  auto& from = static_cast<const SessionResult&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto.SessionResult)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_status_message().empty()) {
+    _this->_internal_set_status_message(from._internal_status_message());
+  }
+  if (from._internal_has_result()) {
+    _this->_internal_mutable_result()->::proto::JobResult::MergeFrom(
+        from._internal_result());
+  }
+  if (from._internal_correlation_id() != 0) {
+    _this->_internal_set_correlation_id(from._internal_correlation_id());
+  }
+  if (from._internal_status_code() != 0) {
+    _this->_internal_set_status_code(from._internal_status_code());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SessionResult::CopyFrom(const SessionResult& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto.SessionResult)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Empty::IsInitialized() const {
+bool SessionResult::IsInitialized() const {
   return true;
 }
 
-void Empty::InternalSwap(Empty* other) {
+void SessionResult::InternalSwap(SessionResult* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.status_message_, lhs_arena,
+      &other->_impl_.status_message_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SessionResult, _impl_.status_code_)
+      + sizeof(SessionResult::_impl_.status_code_)
+      - PROTOBUF_FIELD_OFFSET(SessionResult, _impl_.result_)>(
+          reinterpret_cast<char*>(&_impl_.result_),
+          reinterpret_cast<char*>(&other->_impl_.result_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SessionResult::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_plugin_2eproto_getter, &descriptor_table_plugin_2eproto_once,
+      file_level_metadata_plugin_2eproto[8]);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata Empty::GetMetadata() const {
-  return GetMetadataStatic();
+// ===================================================================
+
+class Empty::_Internal {
+ public:
+};
+
+Empty::Empty(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:proto.Empty)
+}
+Empty::Empty(const Empty& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  Empty* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:proto.Empty)
 }
 
 
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Empty::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Empty::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata Empty::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_plugin_2eproto_getter, &descriptor_table_plugin_2eproto_once,
+      file_level_metadata_plugin_2eproto[9]);
+}
+
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace proto
 PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::proto::Job* Arena::CreateMaybeMessage< ::proto::Job >(Arena* arena) {
-  return Arena::CreateInternal< ::proto::Job >(arena);
+template<> PROTOBUF_NOINLINE ::proto::Job*
+Arena::CreateMaybeMessage< ::proto::Job >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto::Job >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto::Argument*
+Arena::CreateMaybeMessage< ::proto::Argument >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto::Argument >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto::ExecuteRequest*
+Arena::CreateMaybeMessage< ::proto::ExecuteRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto::ExecuteRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto::ManualInteraction*
+Arena::CreateMaybeMessage< ::proto::ManualInteraction >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto::ManualInteraction >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto::JobResult*
+Arena::CreateMaybeMessage< ::proto::JobResult >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto::JobResult >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto::JobOutput*
+Arena::CreateMaybeMessage< ::proto::JobOutput >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto::JobOutput >(arena);
 }
-template<> PROTOBUF_NOINLINE ::proto::Argument* Arena::CreateMaybeMessage< ::proto::Argument >(Arena* arena) {
-  return Arena::CreateInternal< ::proto::Argument >(arena);
+template<> PROTOBUF_NOINLINE ::proto::JobBatch*
+Arena::CreateMaybeMessage< ::proto::JobBatch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto::JobBatch >(arena);
 }
-template<> PROTOBUF_NOINLINE ::proto::ManualInteraction* Arena::CreateMaybeMessage< ::proto::ManualInteraction >(Arena* arena) {
-  return Arena::CreateInternal< ::proto::ManualInteraction >(arena);
+template<> PROTOBUF_NOINLINE ::proto::SessionRequest*
+Arena::CreateMaybeMessage< ::proto::SessionRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto::SessionRequest >(arena);
 }
-template<> PROTOBUF_NOINLINE ::proto::JobResult* Arena::CreateMaybeMessage< ::proto::JobResult >(Arena* arena) {
-  return Arena::CreateInternal< ::proto::JobResult >(arena);
+template<> PROTOBUF_NOINLINE ::proto::SessionResult*
+Arena::CreateMaybeMessage< ::proto::SessionResult >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto::SessionResult >(arena);
 }
-template<> PROTOBUF_NOINLINE ::proto::Empty* Arena::CreateMaybeMessage< ::proto::Empty >(Arena* arena) {
-  return Arena::CreateInternal< ::proto::Empty >(arena);
+template<> PROTOBUF_NOINLINE ::proto::Empty*
+Arena::CreateMaybeMessage< ::proto::Empty >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto::Empty >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
 
@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3011000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3011002 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,10 +23,9 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_bases.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
@@ -43,50 +42,63 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_plugin_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[5]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_plugin_2eproto;
 namespace proto {
 class Argument;
-class ArgumentDefaultTypeInternal;
+struct ArgumentDefaultTypeInternal;
 extern ArgumentDefaultTypeInternal _Argument_default_instance_;
 class Empty;
-class EmptyDefaultTypeInternal;
+struct EmptyDefaultTypeInternal;
 extern EmptyDefaultTypeInternal _Empty_default_instance_;
+class ExecuteRequest;
+struct ExecuteRequestDefaultTypeInternal;
+extern ExecuteRequestDefaultTypeInternal _ExecuteRequest_default_instance_;
 class Job;
-class JobDefaultTypeInternal;
+struct JobDefaultTypeInternal;
 extern JobDefaultTypeInternal _Job_default_instance_;
+class JobBatch;
+struct JobBatchDefaultTypeInternal;
+extern JobBatchDefaultTypeInternal _JobBatch_default_instance_;
+class JobOutput;
+struct JobOutputDefaultTypeInternal;
+extern JobOutputDefaultTypeInternal _JobOutput_default_instance_;
 class JobResult;
-class JobResultDefaultTypeInternal;
+struct JobResultDefaultTypeInternal;
 extern JobResultDefaultTypeInternal _JobResult_default_instance_;
 class ManualInteraction;
-class ManualInteractionDefaultTypeInternal;
+struct ManualInteractionDefaultTypeInternal;
 extern ManualInteractionDefaultTypeInternal _ManualInteraction_default_instance_;
+class SessionRequest;
+struct SessionRequestDefaultTypeInternal;
+extern SessionRequestDefaultTypeInternal _SessionRequest_default_instance_;
+class SessionResult;
+struct SessionResultDefaultTypeInternal;
+extern SessionResultDefaultTypeInternal _SessionResult_default_instance_;
 }  // namespace proto
 PROTOBUF_NAMESPACE_OPEN
 template<> ::proto::Argument* Arena::CreateMaybeMessage<::proto::Argument>(Arena*);
 template<> ::proto::Empty* Arena::CreateMaybeMessage<::proto::Empty>(Arena*);
+template<> ::proto::ExecuteRequest* Arena::CreateMaybeMessage<::proto::ExecuteRequest>(Arena*);
 template<> ::proto::Job* Arena::CreateMaybeMessage<::proto::Job>(Arena*);
+template<> ::proto::JobBatch* Arena::CreateMaybeMessage<::proto::JobBatch>(Arena*);
+template<> ::proto::JobOutput* Arena::CreateMaybeMessage<::proto::JobOutput>(Arena*);
 template<> ::proto::JobResult* Arena::CreateMaybeMessage<::proto::JobResult>(Arena*);
 template<> ::proto::ManualInteraction* Arena::CreateMaybeMessage<::proto::ManualInteraction>(Arena*);
+template<> ::proto::SessionRequest* Arena::CreateMaybeMessage<::proto::SessionRequest>(Arena*);
+template<> ::proto::SessionResult* Arena::CreateMaybeMessage<::proto::SessionResult>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace proto {
 
 // ===================================================================
 
-class Job :
+class Job final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.Job) */ {
  public:
-  Job();
-  virtual ~Job();
+  inline Job() : Job(nullptr) {}
+  ~Job() override;
+  explicit PROTOBUF_CONSTEXPR Job(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Job(const Job& from);
   Job(Job&& from) noexcept
@@ -99,8 +111,13 @@ class Job :
     return *this;
   }
   inline Job& operator=(Job&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -111,14 +128,14 @@ class Job :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Job& default_instance() {
+    return *internal_default_instance();
   }
-  static const Job& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const Job* internal_default_instance() {
     return reinterpret_cast<const Job*>(
                &_Job_default_instance_);
@@ -131,57 +148,66 @@ class Job :
   }
   inline void Swap(Job* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Job* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Job* New() const final {
-    return CreateMaybeMessage<Job>(nullptr);
-  }
-
-  Job* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  Job* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Job>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Job& from);
-  void MergeFrom(const Job& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Job& from) {
+    Job::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Job* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "proto.Job";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit Job(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_plugin_2eproto);
-    return ::descriptor_table_plugin_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -190,9 +216,11 @@ class Job :
   enum : int {
     kDependsonFieldNumber = 4,
     kArgsFieldNumber = 5,
+    kDependson64FieldNumber = 8,
     kTitleFieldNumber = 2,
     kDescriptionFieldNumber = 3,
     kInteractionFieldNumber = 6,
+    kUniqueId64FieldNumber = 7,
     kUniqueIdFieldNumber = 1,
   };
   // repeated uint32 dependson = 4;
@@ -202,19 +230,19 @@ class Job :
   public:
   void clear_dependson();
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_dependson(int index) const;
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+  uint32_t _internal_dependson(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
       _internal_dependson() const;
-  void _internal_add_dependson(::PROTOBUF_NAMESPACE_ID::uint32 value);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+  void _internal_add_dependson(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
       _internal_mutable_dependson();
   public:
-  ::PROTOBUF_NAMESPACE_ID::uint32 dependson(int index) const;
-  void set_dependson(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value);
-  void add_dependson(::PROTOBUF_NAMESPACE_ID::uint32 value);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+  uint32_t dependson(int index) const;
+  void set_dependson(int index, uint32_t value);
+  void add_dependson(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
       dependson() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
       mutable_dependson();
 
   // repeated .proto.Argument args = 5;
@@ -235,35 +263,53 @@ class Job :
   const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Argument >&
       args() const;
 
+  // repeated uint64 dependson64 = 8;
+  int dependson64_size() const;
+  private:
+  int _internal_dependson64_size() const;
+  public:
+  void clear_dependson64();
+  private:
+  uint64_t _internal_dependson64(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_dependson64() const;
+  void _internal_add_dependson64(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_dependson64();
+  public:
+  uint64_t dependson64(int index) const;
+  void set_dependson64(int index, uint64_t value);
+  void add_dependson64(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      dependson64() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_dependson64();
+
   // string title = 2;
   void clear_title();
   const std::string& title() const;
-  void set_title(const std::string& value);
-  void set_title(std::string&& value);
-  void set_title(const char* value);
-  void set_title(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_title(ArgT0&& arg0, ArgT... args);
   std::string* mutable_title();
-  std::string* release_title();
+  PROTOBUF_NODISCARD std::string* release_title();
   void set_allocated_title(std::string* title);
   private:
   const std::string& _internal_title() const;
-  void _internal_set_title(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_title(const std::string& value);
   std::string* _internal_mutable_title();
   public:
 
   // string description = 3;
   void clear_description();
   const std::string& description() const;
-  void set_description(const std::string& value);
-  void set_description(std::string&& value);
-  void set_description(const char* value);
-  void set_description(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_description(ArgT0&& arg0, ArgT... args);
   std::string* mutable_description();
-  std::string* release_description();
+  PROTOBUF_NODISCARD std::string* release_description();
   void set_allocated_description(std::string* description);
   private:
   const std::string& _internal_description() const;
-  void _internal_set_description(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_description(const std::string& value);
   std::string* _internal_mutable_description();
   public:
 
@@ -274,45 +320,66 @@ class Job :
   public:
   void clear_interaction();
   const ::proto::ManualInteraction& interaction() const;
-  ::proto::ManualInteraction* release_interaction();
+  PROTOBUF_NODISCARD ::proto::ManualInteraction* release_interaction();
   ::proto::ManualInteraction* mutable_interaction();
   void set_allocated_interaction(::proto::ManualInteraction* interaction);
   private:
   const ::proto::ManualInteraction& _internal_interaction() const;
   ::proto::ManualInteraction* _internal_mutable_interaction();
   public:
+  void unsafe_arena_set_allocated_interaction(
+      ::proto::ManualInteraction* interaction);
+  ::proto::ManualInteraction* unsafe_arena_release_interaction();
+
+  // uint64 unique_id64 = 7;
+  void clear_unique_id64();
+  uint64_t unique_id64() const;
+  void set_unique_id64(uint64_t value);
+  private:
+  uint64_t _internal_unique_id64() const;
+  void _internal_set_unique_id64(uint64_t value);
+  public:
 
   // uint32 unique_id = 1;
   void clear_unique_id();
-  ::PROTOBUF_NAMESPACE_ID::uint32 unique_id() const;
-  void set_unique_id(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t unique_id() const;
+  void set_unique_id(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_unique_id() const;
-  void _internal_set_unique_id(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_unique_id() const;
+  void _internal_set_unique_id(uint32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:proto.Job)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 > dependson_;
-  mutable std::atomic<int> _dependson_cached_byte_size_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Argument > args_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr title_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr description_;
-  ::proto::ManualInteraction* interaction_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 unique_id_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > dependson_;
+    mutable std::atomic<int> _dependson_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Argument > args_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > dependson64_;
+    mutable std::atomic<int> _dependson64_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr title_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr description_;
+    ::proto::ManualInteraction* interaction_;
+    uint64_t unique_id64_;
+    uint32_t unique_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_plugin_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Argument :
+class Argument final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.Argument) */ {
  public:
-  Argument();
-  virtual ~Argument();
+  inline Argument() : Argument(nullptr) {}
+  ~Argument() override;
+  explicit PROTOBUF_CONSTEXPR Argument(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Argument(const Argument& from);
   Argument(Argument&& from) noexcept
@@ -325,8 +392,13 @@ class Argument :
     return *this;
   }
   inline Argument& operator=(Argument&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -337,14 +409,14 @@ class Argument :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Argument& default_instance() {
+    return *internal_default_instance();
   }
-  static const Argument& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const Argument* internal_default_instance() {
     return reinterpret_cast<const Argument*>(
                &_Argument_default_instance_);
@@ -357,57 +429,66 @@ class Argument :
   }
   inline void Swap(Argument* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Argument* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Argument* New() const final {
-    return CreateMaybeMessage<Argument>(nullptr);
-  }
-
-  Argument* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  Argument* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Argument>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Argument& from);
-  void MergeFrom(const Argument& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Argument& from) {
+    Argument::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Argument* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "proto.Argument";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit Argument(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_plugin_2eproto);
-    return ::descriptor_table_plugin_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -422,64 +503,56 @@ class Argument :
   // string description = 1;
   void clear_description();
   const std::string& description() const;
-  void set_description(const std::string& value);
-  void set_description(std::string&& value);
-  void set_description(const char* value);
-  void set_description(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_description(ArgT0&& arg0, ArgT... args);
   std::string* mutable_description();
-  std::string* release_description();
+  PROTOBUF_NODISCARD std::string* release_description();
   void set_allocated_description(std::string* description);
   private:
   const std::string& _internal_description() const;
-  void _internal_set_description(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_description(const std::string& value);
   std::string* _internal_mutable_description();
   public:
 
   // string type = 2;
   void clear_type();
   const std::string& type() const;
-  void set_type(const std::string& value);
-  void set_type(std::string&& value);
-  void set_type(const char* value);
-  void set_type(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_type(ArgT0&& arg0, ArgT... args);
   std::string* mutable_type();
-  std::string* release_type();
+  PROTOBUF_NODISCARD std::string* release_type();
   void set_allocated_type(std::string* type);
   private:
   const std::string& _internal_type() const;
-  void _internal_set_type(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_type(const std::string& value);
   std::string* _internal_mutable_type();
   public:
 
   // string key = 3;
   void clear_key();
   const std::string& key() const;
-  void set_key(const std::string& value);
-  void set_key(std::string&& value);
-  void set_key(const char* value);
-  void set_key(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
   std::string* mutable_key();
-  std::string* release_key();
+  PROTOBUF_NODISCARD std::string* release_key();
   void set_allocated_key(std::string* key);
   private:
   const std::string& _internal_key() const;
-  void _internal_set_key(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
   std::string* _internal_mutable_key();
   public:
 
   // string value = 4;
   void clear_value();
   const std::string& value() const;
-  void set_value(const std::string& value);
-  void set_value(std::string&& value);
-  void set_value(const char* value);
-  void set_value(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
   std::string* mutable_value();
-  std::string* release_value();
+  PROTOBUF_NODISCARD std::string* release_value();
   void set_allocated_value(std::string* value);
   private:
   const std::string& _internal_value() const;
-  void _internal_set_value(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
   std::string* _internal_mutable_value();
   public:
 
@@ -487,21 +560,206 @@ class Argument :
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr description_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr type_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr description_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr type_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_plugin_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ExecuteRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.ExecuteRequest) */ {
+ public:
+  inline ExecuteRequest() : ExecuteRequest(nullptr) {}
+  ~ExecuteRequest() override;
+  explicit PROTOBUF_CONSTEXPR ExecuteRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ExecuteRequest(const ExecuteRequest& from);
+  ExecuteRequest(ExecuteRequest&& from) noexcept
+    : ExecuteRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ExecuteRequest& operator=(const ExecuteRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ExecuteRequest& operator=(ExecuteRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ExecuteRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ExecuteRequest* internal_default_instance() {
+    return reinterpret_cast<const ExecuteRequest*>(
+               &_ExecuteRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(ExecuteRequest& a, ExecuteRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ExecuteRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ExecuteRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ExecuteRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ExecuteRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ExecuteRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ExecuteRequest& from) {
+    ExecuteRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ExecuteRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto.ExecuteRequest";
+  }
+  protected:
+  explicit ExecuteRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kArgsFieldNumber = 5,
+    kUniqueId64FieldNumber = 7,
+    kUniqueIdFieldNumber = 1,
+  };
+  // repeated .proto.Argument args = 5;
+  int args_size() const;
+  private:
+  int _internal_args_size() const;
+  public:
+  void clear_args();
+  ::proto::Argument* mutable_args(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Argument >*
+      mutable_args();
+  private:
+  const ::proto::Argument& _internal_args(int index) const;
+  ::proto::Argument* _internal_add_args();
+  public:
+  const ::proto::Argument& args(int index) const;
+  ::proto::Argument* add_args();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Argument >&
+      args() const;
+
+  // uint64 unique_id64 = 7;
+  void clear_unique_id64();
+  uint64_t unique_id64() const;
+  void set_unique_id64(uint64_t value);
+  private:
+  uint64_t _internal_unique_id64() const;
+  void _internal_set_unique_id64(uint64_t value);
+  public:
+
+  // uint32 unique_id = 1;
+  void clear_unique_id();
+  uint32_t unique_id() const;
+  void set_unique_id(uint32_t value);
+  private:
+  uint32_t _internal_unique_id() const;
+  void _internal_set_unique_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto.ExecuteRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Argument > args_;
+    uint64_t unique_id64_;
+    uint32_t unique_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_plugin_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ManualInteraction :
+class ManualInteraction final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.ManualInteraction) */ {
  public:
-  ManualInteraction();
-  virtual ~ManualInteraction();
+  inline ManualInteraction() : ManualInteraction(nullptr) {}
+  ~ManualInteraction() override;
+  explicit PROTOBUF_CONSTEXPR ManualInteraction(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ManualInteraction(const ManualInteraction& from);
   ManualInteraction(ManualInteraction&& from) noexcept
@@ -514,8 +772,13 @@ class ManualInteraction :
     return *this;
   }
   inline ManualInteraction& operator=(ManualInteraction&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -526,77 +789,86 @@ class ManualInteraction :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ManualInteraction& default_instance() {
+    return *internal_default_instance();
   }
-  static const ManualInteraction& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const ManualInteraction* internal_default_instance() {
     return reinterpret_cast<const ManualInteraction*>(
                &_ManualInteraction_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    2;
+    3;
 
   friend void swap(ManualInteraction& a, ManualInteraction& b) {
     a.Swap(&b);
   }
   inline void Swap(ManualInteraction* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ManualInteraction* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline ManualInteraction* New() const final {
-    return CreateMaybeMessage<ManualInteraction>(nullptr);
-  }
-
-  ManualInteraction* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  ManualInteraction* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ManualInteraction>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ManualInteraction& from);
-  void MergeFrom(const ManualInteraction& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ManualInteraction& from) {
+    ManualInteraction::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(ManualInteraction* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "proto.ManualInteraction";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit ManualInteraction(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_plugin_2eproto);
-    return ::descriptor_table_plugin_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -610,48 +882,42 @@ class ManualInteraction :
   // string description = 1;
   void clear_description();
   const std::string& description() const;
-  void set_description(const std::string& value);
-  void set_description(std::string&& value);
-  void set_description(const char* value);
-  void set_description(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_description(ArgT0&& arg0, ArgT... args);
   std::string* mutable_description();
-  std::string* release_description();
+  PROTOBUF_NODISCARD std::string* release_description();
   void set_allocated_description(std::string* description);
   private:
   const std::string& _internal_description() const;
-  void _internal_set_description(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_description(const std::string& value);
   std::string* _internal_mutable_description();
   public:
 
   // string type = 2;
   void clear_type();
   const std::string& type() const;
-  void set_type(const std::string& value);
-  void set_type(std::string&& value);
-  void set_type(const char* value);
-  void set_type(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_type(ArgT0&& arg0, ArgT... args);
   std::string* mutable_type();
-  std::string* release_type();
+  PROTOBUF_NODISCARD std::string* release_type();
   void set_allocated_type(std::string* type);
   private:
   const std::string& _internal_type() const;
-  void _internal_set_type(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_type(const std::string& value);
   std::string* _internal_mutable_type();
   public:
 
   // string value = 3;
   void clear_value();
   const std::string& value() const;
-  void set_value(const std::string& value);
-  void set_value(std::string&& value);
-  void set_value(const char* value);
-  void set_value(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
   std::string* mutable_value();
-  std::string* release_value();
+  PROTOBUF_NODISCARD std::string* release_value();
   void set_allocated_value(std::string* value);
   private:
   const std::string& _internal_value() const;
-  void _internal_set_value(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
   std::string* _internal_mutable_value();
   public:
 
@@ -659,20 +925,26 @@ class ManualInteraction :
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr description_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr type_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr description_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr type_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_plugin_2eproto;
 };
 // -------------------------------------------------------------------
 
-class JobResult :
+class JobResult final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.JobResult) */ {
  public:
-  JobResult();
-  virtual ~JobResult();
+  inline JobResult() : JobResult(nullptr) {}
+  ~JobResult() override;
+  explicit PROTOBUF_CONSTEXPR JobResult(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   JobResult(const JobResult& from);
   JobResult(JobResult&& from) noexcept
@@ -685,8 +957,13 @@ class JobResult :
     return *this;
   }
   inline JobResult& operator=(JobResult&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -697,77 +974,86 @@ class JobResult :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const JobResult& default_instance() {
+    return *internal_default_instance();
   }
-  static const JobResult& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const JobResult* internal_default_instance() {
     return reinterpret_cast<const JobResult*>(
                &_JobResult_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    3;
+    4;
 
   friend void swap(JobResult& a, JobResult& b) {
     a.Swap(&b);
   }
   inline void Swap(JobResult* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(JobResult* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline JobResult* New() const final {
-    return CreateMaybeMessage<JobResult>(nullptr);
-  }
-
-  JobResult* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  JobResult* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<JobResult>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const JobResult& from);
-  void MergeFrom(const JobResult& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const JobResult& from) {
+    JobResult::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(JobResult* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "proto.JobResult";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit JobResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_plugin_2eproto);
-    return ::descriptor_table_plugin_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -778,30 +1064,29 @@ class JobResult :
     kUniqueIdFieldNumber = 1,
     kFailedFieldNumber = 2,
     kExitPipelineFieldNumber = 3,
+    kUniqueId64FieldNumber = 5,
   };
   // string message = 4;
   void clear_message();
   const std::string& message() const;
-  void set_message(const std::string& value);
-  void set_message(std::string&& value);
-  void set_message(const char* value);
-  void set_message(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_message(ArgT0&& arg0, ArgT... args);
   std::string* mutable_message();
-  std::string* release_message();
+  PROTOBUF_NODISCARD std::string* release_message();
   void set_allocated_message(std::string* message);
   private:
   const std::string& _internal_message() const;
-  void _internal_set_message(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(const std::string& value);
   std::string* _internal_mutable_message();
   public:
 
   // uint32 unique_id = 1;
   void clear_unique_id();
-  ::PROTOBUF_NAMESPACE_ID::uint32 unique_id() const;
-  void set_unique_id(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t unique_id() const;
+  void set_unique_id(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_unique_id() const;
-  void _internal_set_unique_id(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_unique_id() const;
+  void _internal_set_unique_id(uint32_t value);
   public:
 
   // bool failed = 2;
@@ -822,39 +1107,60 @@ class JobResult :
   void _internal_set_exit_pipeline(bool value);
   public:
 
+  // uint64 unique_id64 = 5;
+  void clear_unique_id64();
+  uint64_t unique_id64() const;
+  void set_unique_id64(uint64_t value);
+  private:
+  uint64_t _internal_unique_id64() const;
+  void _internal_set_unique_id64(uint64_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:proto.JobResult)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 unique_id_;
-  bool failed_;
-  bool exit_pipeline_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
+    uint32_t unique_id_;
+    bool failed_;
+    bool exit_pipeline_;
+    uint64_t unique_id64_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_plugin_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Empty :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.Empty) */ {
+class JobOutput final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.JobOutput) */ {
  public:
-  Empty();
-  virtual ~Empty();
+  inline JobOutput() : JobOutput(nullptr) {}
+  ~JobOutput() override;
+  explicit PROTOBUF_CONSTEXPR JobOutput(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Empty(const Empty& from);
-  Empty(Empty&& from) noexcept
-    : Empty() {
+  JobOutput(const JobOutput& from);
+  JobOutput(JobOutput&& from) noexcept
+    : JobOutput() {
     *this = ::std::move(from);
   }
 
-  inline Empty& operator=(const Empty& from) {
+  inline JobOutput& operator=(const JobOutput& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Empty& operator=(Empty&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline JobOutput& operator=(JobOutput&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -865,89 +1171,813 @@ class Empty :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const JobOutput& default_instance() {
+    return *internal_default_instance();
   }
-  static const Empty& default_instance();
+  enum OutputCase {
+    kLog = 1,
+    kResult = 2,
+    OUTPUT_NOT_SET = 0,
+  };
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const Empty* internal_default_instance() {
-    return reinterpret_cast<const Empty*>(
-               &_Empty_default_instance_);
+  static inline const JobOutput* internal_default_instance() {
+    return reinterpret_cast<const JobOutput*>(
+               &_JobOutput_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    4;
+    5;
 
-  friend void swap(Empty& a, Empty& b) {
+  friend void swap(JobOutput& a, JobOutput& b) {
     a.Swap(&b);
   }
-  inline void Swap(Empty* other) {
+  inline void Swap(JobOutput* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(JobOutput* other) {
     if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Empty* New() const final {
-    return CreateMaybeMessage<Empty>(nullptr);
+  JobOutput* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<JobOutput>(arena);
   }
-
-  Empty* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<Empty>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const JobOutput& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const JobOutput& from) {
+    JobOutput::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const Empty& from);
-  void MergeFrom(const Empty& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Empty* other);
+  void InternalSwap(JobOutput* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "proto.Empty";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "proto.JobOutput";
   }
+  protected:
+  explicit JobOutput(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_plugin_2eproto);
-    return ::descriptor_table_plugin_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // @@protoc_insertion_point(class_scope:proto.Empty)
- private:
-  class _Internal;
+  enum : int {
+    kLogFieldNumber = 1,
+    kResultFieldNumber = 2,
+  };
+  // bytes log = 1;
+  bool has_log() const;
+  private:
+  bool _internal_has_log() const;
+  public:
+  void clear_log();
+  const std::string& log() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_log(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_log();
+  PROTOBUF_NODISCARD std::string* release_log();
+  void set_allocated_log(std::string* log);
+  private:
+  const std::string& _internal_log() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_log(const std::string& value);
+  std::string* _internal_mutable_log();
+  public:
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_plugin_2eproto;
+  // .proto.JobResult result = 2;
+  bool has_result() const;
+  private:
+  bool _internal_has_result() const;
+  public:
+  void clear_result();
+  const ::proto::JobResult& result() const;
+  PROTOBUF_NODISCARD ::proto::JobResult* release_result();
+  ::proto::JobResult* mutable_result();
+  void set_allocated_result(::proto::JobResult* result);
+  private:
+  const ::proto::JobResult& _internal_result() const;
+  ::proto::JobResult* _internal_mutable_result();
+  public:
+  void unsafe_arena_set_allocated_result(
+      ::proto::JobResult* result);
+  ::proto::JobResult* unsafe_arena_release_result();
+
+  void clear_output();
+  OutputCase output_case() const;
+  // @@protoc_insertion_point(class_scope:proto.JobOutput)
+ private:
+  class _Internal;
+  void set_has_log();
+  void set_has_result();
+
+  inline bool has_output() const;
+  inline void clear_has_output();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    union OutputUnion {
+      constexpr OutputUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr log_;
+      ::proto::JobResult* result_;
+    } output_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_plugin_2eproto;
+};
+// -------------------------------------------------------------------
+
+class JobBatch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.JobBatch) */ {
+ public:
+  inline JobBatch() : JobBatch(nullptr) {}
+  ~JobBatch() override;
+  explicit PROTOBUF_CONSTEXPR JobBatch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  JobBatch(const JobBatch& from);
+  JobBatch(JobBatch&& from) noexcept
+    : JobBatch() {
+    *this = ::std::move(from);
+  }
+
+  inline JobBatch& operator=(const JobBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline JobBatch& operator=(JobBatch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const JobBatch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const JobBatch* internal_default_instance() {
+    return reinterpret_cast<const JobBatch*>(
+               &_JobBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(JobBatch& a, JobBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(JobBatch* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(JobBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  JobBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<JobBatch>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const JobBatch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const JobBatch& from) {
+    JobBatch::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(JobBatch* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto.JobBatch";
+  }
+  protected:
+  explicit JobBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kJobsFieldNumber = 1,
+  };
+  // repeated .proto.Job jobs = 1;
+  int jobs_size() const;
+  private:
+  int _internal_jobs_size() const;
+  public:
+  void clear_jobs();
+  ::proto::Job* mutable_jobs(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Job >*
+      mutable_jobs();
+  private:
+  const ::proto::Job& _internal_jobs(int index) const;
+  ::proto::Job* _internal_add_jobs();
+  public:
+  const ::proto::Job& jobs(int index) const;
+  ::proto::Job* add_jobs();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Job >&
+      jobs() const;
+
+  // @@protoc_insertion_point(class_scope:proto.JobBatch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Job > jobs_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_plugin_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SessionRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.SessionRequest) */ {
+ public:
+  inline SessionRequest() : SessionRequest(nullptr) {}
+  ~SessionRequest() override;
+  explicit PROTOBUF_CONSTEXPR SessionRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SessionRequest(const SessionRequest& from);
+  SessionRequest(SessionRequest&& from) noexcept
+    : SessionRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline SessionRequest& operator=(const SessionRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SessionRequest& operator=(SessionRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SessionRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SessionRequest* internal_default_instance() {
+    return reinterpret_cast<const SessionRequest*>(
+               &_SessionRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(SessionRequest& a, SessionRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SessionRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SessionRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SessionRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SessionRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SessionRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SessionRequest& from) {
+    SessionRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SessionRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto.SessionRequest";
+  }
+  protected:
+  explicit SessionRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kExecuteFieldNumber = 2,
+    kCorrelationIdFieldNumber = 1,
+    kCancelFieldNumber = 3,
+  };
+  // .proto.ExecuteRequest execute = 2;
+  bool has_execute() const;
+  private:
+  bool _internal_has_execute() const;
+  public:
+  void clear_execute();
+  const ::proto::ExecuteRequest& execute() const;
+  PROTOBUF_NODISCARD ::proto::ExecuteRequest* release_execute();
+  ::proto::ExecuteRequest* mutable_execute();
+  void set_allocated_execute(::proto::ExecuteRequest* execute);
+  private:
+  const ::proto::ExecuteRequest& _internal_execute() const;
+  ::proto::ExecuteRequest* _internal_mutable_execute();
+  public:
+  void unsafe_arena_set_allocated_execute(
+      ::proto::ExecuteRequest* execute);
+  ::proto::ExecuteRequest* unsafe_arena_release_execute();
+
+  // uint64 correlation_id = 1;
+  void clear_correlation_id();
+  uint64_t correlation_id() const;
+  void set_correlation_id(uint64_t value);
+  private:
+  uint64_t _internal_correlation_id() const;
+  void _internal_set_correlation_id(uint64_t value);
+  public:
+
+  // bool cancel = 3;
+  void clear_cancel();
+  bool cancel() const;
+  void set_cancel(bool value);
+  private:
+  bool _internal_cancel() const;
+  void _internal_set_cancel(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto.SessionRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::proto::ExecuteRequest* execute_;
+    uint64_t correlation_id_;
+    bool cancel_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_plugin_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SessionResult final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.SessionResult) */ {
+ public:
+  inline SessionResult() : SessionResult(nullptr) {}
+  ~SessionResult() override;
+  explicit PROTOBUF_CONSTEXPR SessionResult(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SessionResult(const SessionResult& from);
+  SessionResult(SessionResult&& from) noexcept
+    : SessionResult() {
+    *this = ::std::move(from);
+  }
+
+  inline SessionResult& operator=(const SessionResult& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SessionResult& operator=(SessionResult&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SessionResult& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SessionResult* internal_default_instance() {
+    return reinterpret_cast<const SessionResult*>(
+               &_SessionResult_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(SessionResult& a, SessionResult& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SessionResult* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SessionResult* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SessionResult* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SessionResult>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SessionResult& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SessionResult& from) {
+    SessionResult::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SessionResult* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto.SessionResult";
+  }
+  protected:
+  explicit SessionResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStatusMessageFieldNumber = 4,
+    kResultFieldNumber = 2,
+    kCorrelationIdFieldNumber = 1,
+    kStatusCodeFieldNumber = 3,
+  };
+  // string status_message = 4;
+  void clear_status_message();
+  const std::string& status_message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_status_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_status_message();
+  PROTOBUF_NODISCARD std::string* release_status_message();
+  void set_allocated_status_message(std::string* status_message);
+  private:
+  const std::string& _internal_status_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_status_message(const std::string& value);
+  std::string* _internal_mutable_status_message();
+  public:
+
+  // .proto.JobResult result = 2;
+  bool has_result() const;
+  private:
+  bool _internal_has_result() const;
+  public:
+  void clear_result();
+  const ::proto::JobResult& result() const;
+  PROTOBUF_NODISCARD ::proto::JobResult* release_result();
+  ::proto::JobResult* mutable_result();
+  void set_allocated_result(::proto::JobResult* result);
+  private:
+  const ::proto::JobResult& _internal_result() const;
+  ::proto::JobResult* _internal_mutable_result();
+  public:
+  void unsafe_arena_set_allocated_result(
+      ::proto::JobResult* result);
+  ::proto::JobResult* unsafe_arena_release_result();
+
+  // uint64 correlation_id = 1;
+  void clear_correlation_id();
+  uint64_t correlation_id() const;
+  void set_correlation_id(uint64_t value);
+  private:
+  uint64_t _internal_correlation_id() const;
+  void _internal_set_correlation_id(uint64_t value);
+  public:
+
+  // int32 status_code = 3;
+  void clear_status_code();
+  int32_t status_code() const;
+  void set_status_code(int32_t value);
+  private:
+  int32_t _internal_status_code() const;
+  void _internal_set_status_code(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto.SessionResult)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr status_message_;
+    ::proto::JobResult* result_;
+    uint64_t correlation_id_;
+    int32_t status_code_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_plugin_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Empty final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:proto.Empty) */ {
+ public:
+  inline Empty() : Empty(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR Empty(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Empty(const Empty& from);
+  Empty(Empty&& from) noexcept
+    : Empty() {
+    *this = ::std::move(from);
+  }
+
+  inline Empty& operator=(const Empty& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Empty& operator=(Empty&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Empty& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Empty* internal_default_instance() {
+    return reinterpret_cast<const Empty*>(
+               &_Empty_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(Empty& a, Empty& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Empty* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Empty* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Empty* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Empty>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const Empty& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const Empty& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto.Empty";
+  }
+  protected:
+  explicit Empty(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:proto.Empty)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_plugin_2eproto;
 };
 // ===================================================================
 
@@ -962,73 +1992,58 @@ class Empty :
 
 // uint32 unique_id = 1;
 inline void Job::clear_unique_id() {
-  unique_id_ = 0u;
+  _impl_.unique_id_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 Job::_internal_unique_id() const {
-  return unique_id_;
+inline uint32_t Job::_internal_unique_id() const {
+  return _impl_.unique_id_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 Job::unique_id() const {
+inline uint32_t Job::unique_id() const {
   // @@protoc_insertion_point(field_get:proto.Job.unique_id)
   return _internal_unique_id();
 }
-inline void Job::_internal_set_unique_id(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void Job::_internal_set_unique_id(uint32_t value) {
   
-  unique_id_ = value;
+  _impl_.unique_id_ = value;
 }
-inline void Job::set_unique_id(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void Job::set_unique_id(uint32_t value) {
   _internal_set_unique_id(value);
   // @@protoc_insertion_point(field_set:proto.Job.unique_id)
 }
 
 // string title = 2;
 inline void Job::clear_title() {
-  title_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.title_.ClearToEmpty();
 }
 inline const std::string& Job::title() const {
   // @@protoc_insertion_point(field_get:proto.Job.title)
   return _internal_title();
 }
-inline void Job::set_title(const std::string& value) {
-  _internal_set_title(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Job::set_title(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.title_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:proto.Job.title)
 }
 inline std::string* Job::mutable_title() {
+  std::string* _s = _internal_mutable_title();
   // @@protoc_insertion_point(field_mutable:proto.Job.title)
-  return _internal_mutable_title();
+  return _s;
 }
 inline const std::string& Job::_internal_title() const {
-  return title_.GetNoArena();
+  return _impl_.title_.Get();
 }
 inline void Job::_internal_set_title(const std::string& value) {
   
-  title_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void Job::set_title(std::string&& value) {
-  
-  title_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:proto.Job.title)
-}
-inline void Job::set_title(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  title_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:proto.Job.title)
-}
-inline void Job::set_title(const char* value, size_t size) {
-  
-  title_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:proto.Job.title)
+  _impl_.title_.Set(value, GetArenaForAllocation());
 }
 inline std::string* Job::_internal_mutable_title() {
   
-  return title_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.title_.Mutable(GetArenaForAllocation());
 }
 inline std::string* Job::release_title() {
   // @@protoc_insertion_point(field_release:proto.Job.title)
-  
-  return title_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.title_.Release();
 }
 inline void Job::set_allocated_title(std::string* title) {
   if (title != nullptr) {
@@ -1036,59 +2051,49 @@ inline void Job::set_allocated_title(std::string* title) {
   } else {
     
   }
-  title_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), title);
+  _impl_.title_.SetAllocated(title, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.title_.IsDefault()) {
+    _impl_.title_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:proto.Job.title)
 }
 
 // string description = 3;
 inline void Job::clear_description() {
-  description_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.description_.ClearToEmpty();
 }
 inline const std::string& Job::description() const {
   // @@protoc_insertion_point(field_get:proto.Job.description)
   return _internal_description();
 }
-inline void Job::set_description(const std::string& value) {
-  _internal_set_description(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Job::set_description(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.description_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:proto.Job.description)
 }
 inline std::string* Job::mutable_description() {
+  std::string* _s = _internal_mutable_description();
   // @@protoc_insertion_point(field_mutable:proto.Job.description)
-  return _internal_mutable_description();
+  return _s;
 }
 inline const std::string& Job::_internal_description() const {
-  return description_.GetNoArena();
+  return _impl_.description_.Get();
 }
 inline void Job::_internal_set_description(const std::string& value) {
   
-  description_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void Job::set_description(std::string&& value) {
-  
-  description_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:proto.Job.description)
-}
-inline void Job::set_description(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  description_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:proto.Job.description)
-}
-inline void Job::set_description(const char* value, size_t size) {
-  
-  description_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:proto.Job.description)
+  _impl_.description_.Set(value, GetArenaForAllocation());
 }
 inline std::string* Job::_internal_mutable_description() {
   
-  return description_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.description_.Mutable(GetArenaForAllocation());
 }
 inline std::string* Job::release_description() {
   // @@protoc_insertion_point(field_release:proto.Job.description)
-  
-  return description_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.description_.Release();
 }
 inline void Job::set_allocated_description(std::string* description) {
   if (description != nullptr) {
@@ -1096,52 +2101,57 @@ inline void Job::set_allocated_description(std::string* description) {
   } else {
     
   }
-  description_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), description);
+  _impl_.description_.SetAllocated(description, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.description_.IsDefault()) {
+    _impl_.description_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:proto.Job.description)
 }
 
 // repeated uint32 dependson = 4;
 inline int Job::_internal_dependson_size() const {
-  return dependson_.size();
+  return _impl_.dependson_.size();
 }
 inline int Job::dependson_size() const {
   return _internal_dependson_size();
 }
 inline void Job::clear_dependson() {
-  dependson_.Clear();
+  _impl_.dependson_.Clear();
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 Job::_internal_dependson(int index) const {
-  return dependson_.Get(index);
+inline uint32_t Job::_internal_dependson(int index) const {
+  return _impl_.dependson_.Get(index);
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 Job::dependson(int index) const {
+inline uint32_t Job::dependson(int index) const {
   // @@protoc_insertion_point(field_get:proto.Job.dependson)
   return _internal_dependson(index);
 }
-inline void Job::set_dependson(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  dependson_.Set(index, value);
+inline void Job::set_dependson(int index, uint32_t value) {
+  _impl_.dependson_.Set(index, value);
   // @@protoc_insertion_point(field_set:proto.Job.dependson)
 }
-inline void Job::_internal_add_dependson(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  dependson_.Add(value);
+inline void Job::_internal_add_dependson(uint32_t value) {
+  _impl_.dependson_.Add(value);
 }
-inline void Job::add_dependson(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void Job::add_dependson(uint32_t value) {
   _internal_add_dependson(value);
   // @@protoc_insertion_point(field_add:proto.Job.dependson)
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
 Job::_internal_dependson() const {
-  return dependson_;
+  return _impl_.dependson_;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
 Job::dependson() const {
   // @@protoc_insertion_point(field_list:proto.Job.dependson)
   return _internal_dependson();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
 Job::_internal_mutable_dependson() {
-  return &dependson_;
+  return &_impl_.dependson_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
 Job::mutable_dependson() {
   // @@protoc_insertion_point(field_mutable_list:proto.Job.dependson)
   return _internal_mutable_dependson();
@@ -1149,91 +2159,122 @@ Job::mutable_dependson() {
 
 // repeated .proto.Argument args = 5;
 inline int Job::_internal_args_size() const {
-  return args_.size();
+  return _impl_.args_.size();
 }
 inline int Job::args_size() const {
   return _internal_args_size();
 }
 inline void Job::clear_args() {
-  args_.Clear();
+  _impl_.args_.Clear();
 }
 inline ::proto::Argument* Job::mutable_args(int index) {
   // @@protoc_insertion_point(field_mutable:proto.Job.args)
-  return args_.Mutable(index);
+  return _impl_.args_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Argument >*
 Job::mutable_args() {
   // @@protoc_insertion_point(field_mutable_list:proto.Job.args)
-  return &args_;
+  return &_impl_.args_;
 }
 inline const ::proto::Argument& Job::_internal_args(int index) const {
-  return args_.Get(index);
+  return _impl_.args_.Get(index);
 }
 inline const ::proto::Argument& Job::args(int index) const {
   // @@protoc_insertion_point(field_get:proto.Job.args)
   return _internal_args(index);
 }
 inline ::proto::Argument* Job::_internal_add_args() {
-  return args_.Add();
+  return _impl_.args_.Add();
 }
 inline ::proto::Argument* Job::add_args() {
+  ::proto::Argument* _add = _internal_add_args();
   // @@protoc_insertion_point(field_add:proto.Job.args)
-  return _internal_add_args();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Argument >&
 Job::args() const {
   // @@protoc_insertion_point(field_list:proto.Job.args)
-  return args_;
+  return _impl_.args_;
 }
 
 // .proto.ManualInteraction interaction = 6;
 inline bool Job::_internal_has_interaction() const {
-  return this != internal_default_instance() && interaction_ != nullptr;
+  return this != internal_default_instance() && _impl_.interaction_ != nullptr;
 }
 inline bool Job::has_interaction() const {
   return _internal_has_interaction();
 }
 inline void Job::clear_interaction() {
-  if (GetArenaNoVirtual() == nullptr && interaction_ != nullptr) {
-    delete interaction_;
+  if (GetArenaForAllocation() == nullptr && _impl_.interaction_ != nullptr) {
+    delete _impl_.interaction_;
   }
-  interaction_ = nullptr;
+  _impl_.interaction_ = nullptr;
 }
 inline const ::proto::ManualInteraction& Job::_internal_interaction() const {
-  const ::proto::ManualInteraction* p = interaction_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::proto::ManualInteraction*>(
-      &::proto::_ManualInteraction_default_instance_);
+  const ::proto::ManualInteraction* p = _impl_.interaction_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto::ManualInteraction&>(
+      ::proto::_ManualInteraction_default_instance_);
 }
 inline const ::proto::ManualInteraction& Job::interaction() const {
   // @@protoc_insertion_point(field_get:proto.Job.interaction)
   return _internal_interaction();
 }
+inline void Job::unsafe_arena_set_allocated_interaction(
+    ::proto::ManualInteraction* interaction) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.interaction_);
+  }
+  _impl_.interaction_ = interaction;
+  if (interaction) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto.Job.interaction)
+}
 inline ::proto::ManualInteraction* Job::release_interaction() {
+  
+  ::proto::ManualInteraction* temp = _impl_.interaction_;
+  _impl_.interaction_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::proto::ManualInteraction* Job::unsafe_arena_release_interaction() {
   // @@protoc_insertion_point(field_release:proto.Job.interaction)
   
-  ::proto::ManualInteraction* temp = interaction_;
-  interaction_ = nullptr;
+  ::proto::ManualInteraction* temp = _impl_.interaction_;
+  _impl_.interaction_ = nullptr;
   return temp;
 }
 inline ::proto::ManualInteraction* Job::_internal_mutable_interaction() {
   
-  if (interaction_ == nullptr) {
-    auto* p = CreateMaybeMessage<::proto::ManualInteraction>(GetArenaNoVirtual());
-    interaction_ = p;
+  if (_impl_.interaction_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto::ManualInteraction>(GetArenaForAllocation());
+    _impl_.interaction_ = p;
   }
-  return interaction_;
+  return _impl_.interaction_;
 }
 inline ::proto::ManualInteraction* Job::mutable_interaction() {
+  ::proto::ManualInteraction* _msg = _internal_mutable_interaction();
   // @@protoc_insertion_point(field_mutable:proto.Job.interaction)
-  return _internal_mutable_interaction();
+  return _msg;
 }
 inline void Job::set_allocated_interaction(::proto::ManualInteraction* interaction) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete interaction_;
+    delete _impl_.interaction_;
   }
   if (interaction) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(interaction);
     if (message_arena != submessage_arena) {
       interaction = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, interaction, submessage_arena);
@@ -1242,63 +2283,115 @@ inline void Job::set_allocated_interaction(::proto::ManualInteraction* interacti
   } else {
     
   }
-  interaction_ = interaction;
+  _impl_.interaction_ = interaction;
   // @@protoc_insertion_point(field_set_allocated:proto.Job.interaction)
 }
 
+// uint64 unique_id64 = 7;
+inline void Job::clear_unique_id64() {
+  _impl_.unique_id64_ = uint64_t{0u};
+}
+inline uint64_t Job::_internal_unique_id64() const {
+  return _impl_.unique_id64_;
+}
+inline uint64_t Job::unique_id64() const {
+  // @@protoc_insertion_point(field_get:proto.Job.unique_id64)
+  return _internal_unique_id64();
+}
+inline void Job::_internal_set_unique_id64(uint64_t value) {
+  
+  _impl_.unique_id64_ = value;
+}
+inline void Job::set_unique_id64(uint64_t value) {
+  _internal_set_unique_id64(value);
+  // @@protoc_insertion_point(field_set:proto.Job.unique_id64)
+}
+
+// repeated uint64 dependson64 = 8;
+inline int Job::_internal_dependson64_size() const {
+  return _impl_.dependson64_.size();
+}
+inline int Job::dependson64_size() const {
+  return _internal_dependson64_size();
+}
+inline void Job::clear_dependson64() {
+  _impl_.dependson64_.Clear();
+}
+inline uint64_t Job::_internal_dependson64(int index) const {
+  return _impl_.dependson64_.Get(index);
+}
+inline uint64_t Job::dependson64(int index) const {
+  // @@protoc_insertion_point(field_get:proto.Job.dependson64)
+  return _internal_dependson64(index);
+}
+inline void Job::set_dependson64(int index, uint64_t value) {
+  _impl_.dependson64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto.Job.dependson64)
+}
+inline void Job::_internal_add_dependson64(uint64_t value) {
+  _impl_.dependson64_.Add(value);
+}
+inline void Job::add_dependson64(uint64_t value) {
+  _internal_add_dependson64(value);
+  // @@protoc_insertion_point(field_add:proto.Job.dependson64)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+Job::_internal_dependson64() const {
+  return _impl_.dependson64_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+Job::dependson64() const {
+  // @@protoc_insertion_point(field_list:proto.Job.dependson64)
+  return _internal_dependson64();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+Job::_internal_mutable_dependson64() {
+  return &_impl_.dependson64_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+Job::mutable_dependson64() {
+  // @@protoc_insertion_point(field_mutable_list:proto.Job.dependson64)
+  return _internal_mutable_dependson64();
+}
+
 // -------------------------------------------------------------------
 
 // Argument
 
 // string description = 1;
 inline void Argument::clear_description() {
-  description_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.description_.ClearToEmpty();
 }
 inline const std::string& Argument::description() const {
   // @@protoc_insertion_point(field_get:proto.Argument.description)
   return _internal_description();
 }
-inline void Argument::set_description(const std::string& value) {
-  _internal_set_description(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Argument::set_description(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.description_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:proto.Argument.description)
 }
 inline std::string* Argument::mutable_description() {
+  std::string* _s = _internal_mutable_description();
   // @@protoc_insertion_point(field_mutable:proto.Argument.description)
-  return _internal_mutable_description();
+  return _s;
 }
 inline const std::string& Argument::_internal_description() const {
-  return description_.GetNoArena();
+  return _impl_.description_.Get();
 }
 inline void Argument::_internal_set_description(const std::string& value) {
   
-  description_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void Argument::set_description(std::string&& value) {
-  
-  description_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:proto.Argument.description)
-}
-inline void Argument::set_description(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  description_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:proto.Argument.description)
-}
-inline void Argument::set_description(const char* value, size_t size) {
-  
-  description_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:proto.Argument.description)
+  _impl_.description_.Set(value, GetArenaForAllocation());
 }
 inline std::string* Argument::_internal_mutable_description() {
   
-  return description_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.description_.Mutable(GetArenaForAllocation());
 }
 inline std::string* Argument::release_description() {
   // @@protoc_insertion_point(field_release:proto.Argument.description)
-  
-  return description_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.description_.Release();
 }
 inline void Argument::set_allocated_description(std::string* description) {
   if (description != nullptr) {
@@ -1306,59 +2399,49 @@ inline void Argument::set_allocated_description(std::string* description) {
   } else {
     
   }
-  description_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), description);
+  _impl_.description_.SetAllocated(description, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.description_.IsDefault()) {
+    _impl_.description_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:proto.Argument.description)
 }
 
 // string type = 2;
 inline void Argument::clear_type() {
-  type_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.type_.ClearToEmpty();
 }
 inline const std::string& Argument::type() const {
   // @@protoc_insertion_point(field_get:proto.Argument.type)
   return _internal_type();
 }
-inline void Argument::set_type(const std::string& value) {
-  _internal_set_type(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Argument::set_type(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.type_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:proto.Argument.type)
 }
 inline std::string* Argument::mutable_type() {
+  std::string* _s = _internal_mutable_type();
   // @@protoc_insertion_point(field_mutable:proto.Argument.type)
-  return _internal_mutable_type();
+  return _s;
 }
 inline const std::string& Argument::_internal_type() const {
-  return type_.GetNoArena();
+  return _impl_.type_.Get();
 }
 inline void Argument::_internal_set_type(const std::string& value) {
   
-  type_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void Argument::set_type(std::string&& value) {
-  
-  type_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:proto.Argument.type)
-}
-inline void Argument::set_type(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  type_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:proto.Argument.type)
-}
-inline void Argument::set_type(const char* value, size_t size) {
-  
-  type_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:proto.Argument.type)
+  _impl_.type_.Set(value, GetArenaForAllocation());
 }
 inline std::string* Argument::_internal_mutable_type() {
   
-  return type_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.type_.Mutable(GetArenaForAllocation());
 }
 inline std::string* Argument::release_type() {
   // @@protoc_insertion_point(field_release:proto.Argument.type)
-  
-  return type_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.type_.Release();
 }
 inline void Argument::set_allocated_type(std::string* type) {
   if (type != nullptr) {
@@ -1366,59 +2449,49 @@ inline void Argument::set_allocated_type(std::string* type) {
   } else {
     
   }
-  type_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), type);
+  _impl_.type_.SetAllocated(type, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.type_.IsDefault()) {
+    _impl_.type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:proto.Argument.type)
 }
 
 // string key = 3;
 inline void Argument::clear_key() {
-  key_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.key_.ClearToEmpty();
 }
 inline const std::string& Argument::key() const {
   // @@protoc_insertion_point(field_get:proto.Argument.key)
   return _internal_key();
 }
-inline void Argument::set_key(const std::string& value) {
-  _internal_set_key(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Argument::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:proto.Argument.key)
 }
 inline std::string* Argument::mutable_key() {
+  std::string* _s = _internal_mutable_key();
   // @@protoc_insertion_point(field_mutable:proto.Argument.key)
-  return _internal_mutable_key();
+  return _s;
 }
 inline const std::string& Argument::_internal_key() const {
-  return key_.GetNoArena();
+  return _impl_.key_.Get();
 }
 inline void Argument::_internal_set_key(const std::string& value) {
   
-  key_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void Argument::set_key(std::string&& value) {
-  
-  key_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:proto.Argument.key)
-}
-inline void Argument::set_key(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  key_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:proto.Argument.key)
-}
-inline void Argument::set_key(const char* value, size_t size) {
-  
-  key_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:proto.Argument.key)
+  _impl_.key_.Set(value, GetArenaForAllocation());
 }
 inline std::string* Argument::_internal_mutable_key() {
   
-  return key_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.key_.Mutable(GetArenaForAllocation());
 }
 inline std::string* Argument::release_key() {
   // @@protoc_insertion_point(field_release:proto.Argument.key)
-  
-  return key_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.key_.Release();
 }
 inline void Argument::set_allocated_key(std::string* key) {
   if (key != nullptr) {
@@ -1426,68 +2499,147 @@ inline void Argument::set_allocated_key(std::string* key) {
   } else {
     
   }
-  key_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), key);
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:proto.Argument.key)
 }
 
 // string value = 4;
 inline void Argument::clear_value() {
-  value_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.value_.ClearToEmpty();
 }
 inline const std::string& Argument::value() const {
   // @@protoc_insertion_point(field_get:proto.Argument.value)
   return _internal_value();
 }
-inline void Argument::set_value(const std::string& value) {
-  _internal_set_value(value);
-  // @@protoc_insertion_point(field_set:proto.Argument.value)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Argument::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:proto.Argument.value)
+}
+inline std::string* Argument::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:proto.Argument.value)
+  return _s;
+}
+inline const std::string& Argument::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void Argument::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Argument::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Argument::release_value() {
+  // @@protoc_insertion_point(field_release:proto.Argument.value)
+  return _impl_.value_.Release();
+}
+inline void Argument::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto.Argument.value)
+}
+
+// -------------------------------------------------------------------
+
+// ExecuteRequest
+
+// uint32 unique_id = 1;
+inline void ExecuteRequest::clear_unique_id() {
+  _impl_.unique_id_ = 0u;
+}
+inline uint32_t ExecuteRequest::_internal_unique_id() const {
+  return _impl_.unique_id_;
+}
+inline uint32_t ExecuteRequest::unique_id() const {
+  // @@protoc_insertion_point(field_get:proto.ExecuteRequest.unique_id)
+  return _internal_unique_id();
+}
+inline void ExecuteRequest::_internal_set_unique_id(uint32_t value) {
+  
+  _impl_.unique_id_ = value;
+}
+inline void ExecuteRequest::set_unique_id(uint32_t value) {
+  _internal_set_unique_id(value);
+  // @@protoc_insertion_point(field_set:proto.ExecuteRequest.unique_id)
+}
+
+// repeated .proto.Argument args = 5;
+inline int ExecuteRequest::_internal_args_size() const {
+  return _impl_.args_.size();
+}
+inline int ExecuteRequest::args_size() const {
+  return _internal_args_size();
+}
+inline void ExecuteRequest::clear_args() {
+  _impl_.args_.Clear();
+}
+inline ::proto::Argument* ExecuteRequest::mutable_args(int index) {
+  // @@protoc_insertion_point(field_mutable:proto.ExecuteRequest.args)
+  return _impl_.args_.Mutable(index);
 }
-inline std::string* Argument::mutable_value() {
-  // @@protoc_insertion_point(field_mutable:proto.Argument.value)
-  return _internal_mutable_value();
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Argument >*
+ExecuteRequest::mutable_args() {
+  // @@protoc_insertion_point(field_mutable_list:proto.ExecuteRequest.args)
+  return &_impl_.args_;
 }
-inline const std::string& Argument::_internal_value() const {
-  return value_.GetNoArena();
+inline const ::proto::Argument& ExecuteRequest::_internal_args(int index) const {
+  return _impl_.args_.Get(index);
 }
-inline void Argument::_internal_set_value(const std::string& value) {
-  
-  value_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+inline const ::proto::Argument& ExecuteRequest::args(int index) const {
+  // @@protoc_insertion_point(field_get:proto.ExecuteRequest.args)
+  return _internal_args(index);
 }
-inline void Argument::set_value(std::string&& value) {
-  
-  value_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:proto.Argument.value)
+inline ::proto::Argument* ExecuteRequest::_internal_add_args() {
+  return _impl_.args_.Add();
 }
-inline void Argument::set_value(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  value_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:proto.Argument.value)
+inline ::proto::Argument* ExecuteRequest::add_args() {
+  ::proto::Argument* _add = _internal_add_args();
+  // @@protoc_insertion_point(field_add:proto.ExecuteRequest.args)
+  return _add;
 }
-inline void Argument::set_value(const char* value, size_t size) {
-  
-  value_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:proto.Argument.value)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Argument >&
+ExecuteRequest::args() const {
+  // @@protoc_insertion_point(field_list:proto.ExecuteRequest.args)
+  return _impl_.args_;
 }
-inline std::string* Argument::_internal_mutable_value() {
-  
-  return value_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+
+// uint64 unique_id64 = 7;
+inline void ExecuteRequest::clear_unique_id64() {
+  _impl_.unique_id64_ = uint64_t{0u};
 }
-inline std::string* Argument::release_value() {
-  // @@protoc_insertion_point(field_release:proto.Argument.value)
+inline uint64_t ExecuteRequest::_internal_unique_id64() const {
+  return _impl_.unique_id64_;
+}
+inline uint64_t ExecuteRequest::unique_id64() const {
+  // @@protoc_insertion_point(field_get:proto.ExecuteRequest.unique_id64)
+  return _internal_unique_id64();
+}
+inline void ExecuteRequest::_internal_set_unique_id64(uint64_t value) {
   
-  return value_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.unique_id64_ = value;
 }
-inline void Argument::set_allocated_value(std::string* value) {
-  if (value != nullptr) {
-    
-  } else {
-    
-  }
-  value_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set_allocated:proto.Argument.value)
+inline void ExecuteRequest::set_unique_id64(uint64_t value) {
+  _internal_set_unique_id64(value);
+  // @@protoc_insertion_point(field_set:proto.ExecuteRequest.unique_id64)
 }
 
 // -------------------------------------------------------------------
@@ -1496,53 +2648,38 @@ inline void Argument::set_allocated_value(std::string* value) {
 
 // string description = 1;
 inline void ManualInteraction::clear_description() {
-  description_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.description_.ClearToEmpty();
 }
 inline const std::string& ManualInteraction::description() const {
   // @@protoc_insertion_point(field_get:proto.ManualInteraction.description)
   return _internal_description();
 }
-inline void ManualInteraction::set_description(const std::string& value) {
-  _internal_set_description(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ManualInteraction::set_description(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.description_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:proto.ManualInteraction.description)
 }
 inline std::string* ManualInteraction::mutable_description() {
+  std::string* _s = _internal_mutable_description();
   // @@protoc_insertion_point(field_mutable:proto.ManualInteraction.description)
-  return _internal_mutable_description();
+  return _s;
 }
 inline const std::string& ManualInteraction::_internal_description() const {
-  return description_.GetNoArena();
+  return _impl_.description_.Get();
 }
 inline void ManualInteraction::_internal_set_description(const std::string& value) {
   
-  description_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void ManualInteraction::set_description(std::string&& value) {
-  
-  description_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:proto.ManualInteraction.description)
-}
-inline void ManualInteraction::set_description(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  description_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:proto.ManualInteraction.description)
-}
-inline void ManualInteraction::set_description(const char* value, size_t size) {
-  
-  description_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:proto.ManualInteraction.description)
+  _impl_.description_.Set(value, GetArenaForAllocation());
 }
 inline std::string* ManualInteraction::_internal_mutable_description() {
   
-  return description_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.description_.Mutable(GetArenaForAllocation());
 }
 inline std::string* ManualInteraction::release_description() {
   // @@protoc_insertion_point(field_release:proto.ManualInteraction.description)
-  
-  return description_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.description_.Release();
 }
 inline void ManualInteraction::set_allocated_description(std::string* description) {
   if (description != nullptr) {
@@ -1550,59 +2687,49 @@ inline void ManualInteraction::set_allocated_description(std::string* descriptio
   } else {
     
   }
-  description_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), description);
+  _impl_.description_.SetAllocated(description, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.description_.IsDefault()) {
+    _impl_.description_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:proto.ManualInteraction.description)
 }
 
 // string type = 2;
 inline void ManualInteraction::clear_type() {
-  type_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.type_.ClearToEmpty();
 }
 inline const std::string& ManualInteraction::type() const {
   // @@protoc_insertion_point(field_get:proto.ManualInteraction.type)
   return _internal_type();
 }
-inline void ManualInteraction::set_type(const std::string& value) {
-  _internal_set_type(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ManualInteraction::set_type(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.type_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:proto.ManualInteraction.type)
 }
 inline std::string* ManualInteraction::mutable_type() {
+  std::string* _s = _internal_mutable_type();
   // @@protoc_insertion_point(field_mutable:proto.ManualInteraction.type)
-  return _internal_mutable_type();
+  return _s;
 }
 inline const std::string& ManualInteraction::_internal_type() const {
-  return type_.GetNoArena();
+  return _impl_.type_.Get();
 }
 inline void ManualInteraction::_internal_set_type(const std::string& value) {
   
-  type_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void ManualInteraction::set_type(std::string&& value) {
-  
-  type_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:proto.ManualInteraction.type)
-}
-inline void ManualInteraction::set_type(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  type_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:proto.ManualInteraction.type)
-}
-inline void ManualInteraction::set_type(const char* value, size_t size) {
-  
-  type_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:proto.ManualInteraction.type)
+  _impl_.type_.Set(value, GetArenaForAllocation());
 }
 inline std::string* ManualInteraction::_internal_mutable_type() {
   
-  return type_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.type_.Mutable(GetArenaForAllocation());
 }
 inline std::string* ManualInteraction::release_type() {
   // @@protoc_insertion_point(field_release:proto.ManualInteraction.type)
-  
-  return type_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.type_.Release();
 }
 inline void ManualInteraction::set_allocated_type(std::string* type) {
   if (type != nullptr) {
@@ -1610,59 +2737,49 @@ inline void ManualInteraction::set_allocated_type(std::string* type) {
   } else {
     
   }
-  type_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), type);
+  _impl_.type_.SetAllocated(type, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.type_.IsDefault()) {
+    _impl_.type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:proto.ManualInteraction.type)
 }
 
 // string value = 3;
 inline void ManualInteraction::clear_value() {
-  value_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.value_.ClearToEmpty();
 }
 inline const std::string& ManualInteraction::value() const {
   // @@protoc_insertion_point(field_get:proto.ManualInteraction.value)
   return _internal_value();
 }
-inline void ManualInteraction::set_value(const std::string& value) {
-  _internal_set_value(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ManualInteraction::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:proto.ManualInteraction.value)
 }
 inline std::string* ManualInteraction::mutable_value() {
+  std::string* _s = _internal_mutable_value();
   // @@protoc_insertion_point(field_mutable:proto.ManualInteraction.value)
-  return _internal_mutable_value();
+  return _s;
 }
 inline const std::string& ManualInteraction::_internal_value() const {
-  return value_.GetNoArena();
+  return _impl_.value_.Get();
 }
 inline void ManualInteraction::_internal_set_value(const std::string& value) {
   
-  value_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void ManualInteraction::set_value(std::string&& value) {
-  
-  value_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:proto.ManualInteraction.value)
-}
-inline void ManualInteraction::set_value(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  value_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:proto.ManualInteraction.value)
-}
-inline void ManualInteraction::set_value(const char* value, size_t size) {
-  
-  value_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:proto.ManualInteraction.value)
+  _impl_.value_.Set(value, GetArenaForAllocation());
 }
 inline std::string* ManualInteraction::_internal_mutable_value() {
   
-  return value_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.value_.Mutable(GetArenaForAllocation());
 }
 inline std::string* ManualInteraction::release_value() {
   // @@protoc_insertion_point(field_release:proto.ManualInteraction.value)
-  
-  return value_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.value_.Release();
 }
 inline void ManualInteraction::set_allocated_value(std::string* value) {
   if (value != nullptr) {
@@ -1670,7 +2787,12 @@ inline void ManualInteraction::set_allocated_value(std::string* value) {
   } else {
     
   }
-  value_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:proto.ManualInteraction.value)
 }
 
@@ -1680,30 +2802,30 @@ inline void ManualInteraction::set_allocated_value(std::string* value) {
 
 // uint32 unique_id = 1;
 inline void JobResult::clear_unique_id() {
-  unique_id_ = 0u;
+  _impl_.unique_id_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 JobResult::_internal_unique_id() const {
-  return unique_id_;
+inline uint32_t JobResult::_internal_unique_id() const {
+  return _impl_.unique_id_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 JobResult::unique_id() const {
+inline uint32_t JobResult::unique_id() const {
   // @@protoc_insertion_point(field_get:proto.JobResult.unique_id)
   return _internal_unique_id();
 }
-inline void JobResult::_internal_set_unique_id(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void JobResult::_internal_set_unique_id(uint32_t value) {
   
-  unique_id_ = value;
+  _impl_.unique_id_ = value;
 }
-inline void JobResult::set_unique_id(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void JobResult::set_unique_id(uint32_t value) {
   _internal_set_unique_id(value);
   // @@protoc_insertion_point(field_set:proto.JobResult.unique_id)
 }
 
 // bool failed = 2;
 inline void JobResult::clear_failed() {
-  failed_ = false;
+  _impl_.failed_ = false;
 }
 inline bool JobResult::_internal_failed() const {
-  return failed_;
+  return _impl_.failed_;
 }
 inline bool JobResult::failed() const {
   // @@protoc_insertion_point(field_get:proto.JobResult.failed)
@@ -1711,7 +2833,7 @@ inline bool JobResult::failed() const {
 }
 inline void JobResult::_internal_set_failed(bool value) {
   
-  failed_ = value;
+  _impl_.failed_ = value;
 }
 inline void JobResult::set_failed(bool value) {
   _internal_set_failed(value);
@@ -1720,10 +2842,10 @@ inline void JobResult::set_failed(bool value) {
 
 // bool exit_pipeline = 3;
 inline void JobResult::clear_exit_pipeline() {
-  exit_pipeline_ = false;
+  _impl_.exit_pipeline_ = false;
 }
 inline bool JobResult::_internal_exit_pipeline() const {
-  return exit_pipeline_;
+  return _impl_.exit_pipeline_;
 }
 inline bool JobResult::exit_pipeline() const {
   // @@protoc_insertion_point(field_get:proto.JobResult.exit_pipeline)
@@ -1731,7 +2853,7 @@ inline bool JobResult::exit_pipeline() const {
 }
 inline void JobResult::_internal_set_exit_pipeline(bool value) {
   
-  exit_pipeline_ = value;
+  _impl_.exit_pipeline_ = value;
 }
 inline void JobResult::set_exit_pipeline(bool value) {
   _internal_set_exit_pipeline(value);
@@ -1740,62 +2862,598 @@ inline void JobResult::set_exit_pipeline(bool value) {
 
 // string message = 4;
 inline void JobResult::clear_message() {
-  message_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.message_.ClearToEmpty();
 }
 inline const std::string& JobResult::message() const {
   // @@protoc_insertion_point(field_get:proto.JobResult.message)
   return _internal_message();
 }
-inline void JobResult::set_message(const std::string& value) {
-  _internal_set_message(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void JobResult::set_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:proto.JobResult.message)
 }
 inline std::string* JobResult::mutable_message() {
+  std::string* _s = _internal_mutable_message();
   // @@protoc_insertion_point(field_mutable:proto.JobResult.message)
-  return _internal_mutable_message();
+  return _s;
 }
 inline const std::string& JobResult::_internal_message() const {
-  return message_.GetNoArena();
+  return _impl_.message_.Get();
 }
 inline void JobResult::_internal_set_message(const std::string& value) {
   
-  message_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  _impl_.message_.Set(value, GetArenaForAllocation());
+}
+inline std::string* JobResult::_internal_mutable_message() {
+  
+  return _impl_.message_.Mutable(GetArenaForAllocation());
+}
+inline std::string* JobResult::release_message() {
+  // @@protoc_insertion_point(field_release:proto.JobResult.message)
+  return _impl_.message_.Release();
+}
+inline void JobResult::set_allocated_message(std::string* message) {
+  if (message != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto.JobResult.message)
+}
+
+// uint64 unique_id64 = 5;
+inline void JobResult::clear_unique_id64() {
+  _impl_.unique_id64_ = uint64_t{0u};
+}
+inline uint64_t JobResult::_internal_unique_id64() const {
+  return _impl_.unique_id64_;
+}
+inline uint64_t JobResult::unique_id64() const {
+  // @@protoc_insertion_point(field_get:proto.JobResult.unique_id64)
+  return _internal_unique_id64();
+}
+inline void JobResult::_internal_set_unique_id64(uint64_t value) {
+  
+  _impl_.unique_id64_ = value;
+}
+inline void JobResult::set_unique_id64(uint64_t value) {
+  _internal_set_unique_id64(value);
+  // @@protoc_insertion_point(field_set:proto.JobResult.unique_id64)
+}
+
+// -------------------------------------------------------------------
+
+// JobOutput
+
+// bytes log = 1;
+inline bool JobOutput::_internal_has_log() const {
+  return output_case() == kLog;
+}
+inline bool JobOutput::has_log() const {
+  return _internal_has_log();
+}
+inline void JobOutput::set_has_log() {
+  _impl_._oneof_case_[0] = kLog;
+}
+inline void JobOutput::clear_log() {
+  if (_internal_has_log()) {
+    _impl_.output_.log_.Destroy();
+    clear_has_output();
+  }
+}
+inline const std::string& JobOutput::log() const {
+  // @@protoc_insertion_point(field_get:proto.JobOutput.log)
+  return _internal_log();
+}
+template <typename ArgT0, typename... ArgT>
+inline void JobOutput::set_log(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_log()) {
+    clear_output();
+    set_has_log();
+    _impl_.output_.log_.InitDefault();
+  }
+  _impl_.output_.log_.SetBytes( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:proto.JobOutput.log)
+}
+inline std::string* JobOutput::mutable_log() {
+  std::string* _s = _internal_mutable_log();
+  // @@protoc_insertion_point(field_mutable:proto.JobOutput.log)
+  return _s;
+}
+inline const std::string& JobOutput::_internal_log() const {
+  if (_internal_has_log()) {
+    return _impl_.output_.log_.Get();
+  }
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
+}
+inline void JobOutput::_internal_set_log(const std::string& value) {
+  if (!_internal_has_log()) {
+    clear_output();
+    set_has_log();
+    _impl_.output_.log_.InitDefault();
+  }
+  _impl_.output_.log_.Set(value, GetArenaForAllocation());
+}
+inline std::string* JobOutput::_internal_mutable_log() {
+  if (!_internal_has_log()) {
+    clear_output();
+    set_has_log();
+    _impl_.output_.log_.InitDefault();
+  }
+  return _impl_.output_.log_.Mutable(      GetArenaForAllocation());
+}
+inline std::string* JobOutput::release_log() {
+  // @@protoc_insertion_point(field_release:proto.JobOutput.log)
+  if (_internal_has_log()) {
+    clear_has_output();
+    return _impl_.output_.log_.Release();
+  } else {
+    return nullptr;
+  }
+}
+inline void JobOutput::set_allocated_log(std::string* log) {
+  if (has_output()) {
+    clear_output();
+  }
+  if (log != nullptr) {
+    set_has_log();
+    _impl_.output_.log_.InitAllocated(log, GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(field_set_allocated:proto.JobOutput.log)
+}
+
+// .proto.JobResult result = 2;
+inline bool JobOutput::_internal_has_result() const {
+  return output_case() == kResult;
+}
+inline bool JobOutput::has_result() const {
+  return _internal_has_result();
+}
+inline void JobOutput::set_has_result() {
+  _impl_._oneof_case_[0] = kResult;
+}
+inline void JobOutput::clear_result() {
+  if (_internal_has_result()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.output_.result_;
+    }
+    clear_has_output();
+  }
+}
+inline ::proto::JobResult* JobOutput::release_result() {
+  // @@protoc_insertion_point(field_release:proto.JobOutput.result)
+  if (_internal_has_result()) {
+    clear_has_output();
+    ::proto::JobResult* temp = _impl_.output_.result_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.output_.result_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::proto::JobResult& JobOutput::_internal_result() const {
+  return _internal_has_result()
+      ? *_impl_.output_.result_
+      : reinterpret_cast< ::proto::JobResult&>(::proto::_JobResult_default_instance_);
+}
+inline const ::proto::JobResult& JobOutput::result() const {
+  // @@protoc_insertion_point(field_get:proto.JobOutput.result)
+  return _internal_result();
+}
+inline ::proto::JobResult* JobOutput::unsafe_arena_release_result() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:proto.JobOutput.result)
+  if (_internal_has_result()) {
+    clear_has_output();
+    ::proto::JobResult* temp = _impl_.output_.result_;
+    _impl_.output_.result_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void JobOutput::unsafe_arena_set_allocated_result(::proto::JobResult* result) {
+  clear_output();
+  if (result) {
+    set_has_result();
+    _impl_.output_.result_ = result;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto.JobOutput.result)
+}
+inline ::proto::JobResult* JobOutput::_internal_mutable_result() {
+  if (!_internal_has_result()) {
+    clear_output();
+    set_has_result();
+    _impl_.output_.result_ = CreateMaybeMessage< ::proto::JobResult >(GetArenaForAllocation());
+  }
+  return _impl_.output_.result_;
+}
+inline ::proto::JobResult* JobOutput::mutable_result() {
+  ::proto::JobResult* _msg = _internal_mutable_result();
+  // @@protoc_insertion_point(field_mutable:proto.JobOutput.result)
+  return _msg;
+}
+
+inline bool JobOutput::has_output() const {
+  return output_case() != OUTPUT_NOT_SET;
+}
+inline void JobOutput::clear_has_output() {
+  _impl_._oneof_case_[0] = OUTPUT_NOT_SET;
+}
+inline JobOutput::OutputCase JobOutput::output_case() const {
+  return JobOutput::OutputCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// JobBatch
+
+// repeated .proto.Job jobs = 1;
+inline int JobBatch::_internal_jobs_size() const {
+  return _impl_.jobs_.size();
+}
+inline int JobBatch::jobs_size() const {
+  return _internal_jobs_size();
+}
+inline void JobBatch::clear_jobs() {
+  _impl_.jobs_.Clear();
+}
+inline ::proto::Job* JobBatch::mutable_jobs(int index) {
+  // @@protoc_insertion_point(field_mutable:proto.JobBatch.jobs)
+  return _impl_.jobs_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Job >*
+JobBatch::mutable_jobs() {
+  // @@protoc_insertion_point(field_mutable_list:proto.JobBatch.jobs)
+  return &_impl_.jobs_;
+}
+inline const ::proto::Job& JobBatch::_internal_jobs(int index) const {
+  return _impl_.jobs_.Get(index);
+}
+inline const ::proto::Job& JobBatch::jobs(int index) const {
+  // @@protoc_insertion_point(field_get:proto.JobBatch.jobs)
+  return _internal_jobs(index);
+}
+inline ::proto::Job* JobBatch::_internal_add_jobs() {
+  return _impl_.jobs_.Add();
+}
+inline ::proto::Job* JobBatch::add_jobs() {
+  ::proto::Job* _add = _internal_add_jobs();
+  // @@protoc_insertion_point(field_add:proto.JobBatch.jobs)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Job >&
+JobBatch::jobs() const {
+  // @@protoc_insertion_point(field_list:proto.JobBatch.jobs)
+  return _impl_.jobs_;
+}
+
+// -------------------------------------------------------------------
+
+// SessionRequest
+
+// uint64 correlation_id = 1;
+inline void SessionRequest::clear_correlation_id() {
+  _impl_.correlation_id_ = uint64_t{0u};
+}
+inline uint64_t SessionRequest::_internal_correlation_id() const {
+  return _impl_.correlation_id_;
+}
+inline uint64_t SessionRequest::correlation_id() const {
+  // @@protoc_insertion_point(field_get:proto.SessionRequest.correlation_id)
+  return _internal_correlation_id();
+}
+inline void SessionRequest::_internal_set_correlation_id(uint64_t value) {
+  
+  _impl_.correlation_id_ = value;
+}
+inline void SessionRequest::set_correlation_id(uint64_t value) {
+  _internal_set_correlation_id(value);
+  // @@protoc_insertion_point(field_set:proto.SessionRequest.correlation_id)
+}
+
+// .proto.ExecuteRequest execute = 2;
+inline bool SessionRequest::_internal_has_execute() const {
+  return this != internal_default_instance() && _impl_.execute_ != nullptr;
+}
+inline bool SessionRequest::has_execute() const {
+  return _internal_has_execute();
+}
+inline void SessionRequest::clear_execute() {
+  if (GetArenaForAllocation() == nullptr && _impl_.execute_ != nullptr) {
+    delete _impl_.execute_;
+  }
+  _impl_.execute_ = nullptr;
+}
+inline const ::proto::ExecuteRequest& SessionRequest::_internal_execute() const {
+  const ::proto::ExecuteRequest* p = _impl_.execute_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto::ExecuteRequest&>(
+      ::proto::_ExecuteRequest_default_instance_);
+}
+inline const ::proto::ExecuteRequest& SessionRequest::execute() const {
+  // @@protoc_insertion_point(field_get:proto.SessionRequest.execute)
+  return _internal_execute();
+}
+inline void SessionRequest::unsafe_arena_set_allocated_execute(
+    ::proto::ExecuteRequest* execute) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.execute_);
+  }
+  _impl_.execute_ = execute;
+  if (execute) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto.SessionRequest.execute)
 }
-inline void JobResult::set_message(std::string&& value) {
+inline ::proto::ExecuteRequest* SessionRequest::release_execute() {
   
-  message_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:proto.JobResult.message)
+  ::proto::ExecuteRequest* temp = _impl_.execute_;
+  _impl_.execute_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void JobResult::set_message(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
+inline ::proto::ExecuteRequest* SessionRequest::unsafe_arena_release_execute() {
+  // @@protoc_insertion_point(field_release:proto.SessionRequest.execute)
   
-  message_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:proto.JobResult.message)
+  ::proto::ExecuteRequest* temp = _impl_.execute_;
+  _impl_.execute_ = nullptr;
+  return temp;
 }
-inline void JobResult::set_message(const char* value, size_t size) {
+inline ::proto::ExecuteRequest* SessionRequest::_internal_mutable_execute() {
   
-  message_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:proto.JobResult.message)
+  if (_impl_.execute_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto::ExecuteRequest>(GetArenaForAllocation());
+    _impl_.execute_ = p;
+  }
+  return _impl_.execute_;
 }
-inline std::string* JobResult::_internal_mutable_message() {
+inline ::proto::ExecuteRequest* SessionRequest::mutable_execute() {
+  ::proto::ExecuteRequest* _msg = _internal_mutable_execute();
+  // @@protoc_insertion_point(field_mutable:proto.SessionRequest.execute)
+  return _msg;
+}
+inline void SessionRequest::set_allocated_execute(::proto::ExecuteRequest* execute) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.execute_;
+  }
+  if (execute) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(execute);
+    if (message_arena != submessage_arena) {
+      execute = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, execute, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.execute_ = execute;
+  // @@protoc_insertion_point(field_set_allocated:proto.SessionRequest.execute)
+}
+
+// bool cancel = 3;
+inline void SessionRequest::clear_cancel() {
+  _impl_.cancel_ = false;
+}
+inline bool SessionRequest::_internal_cancel() const {
+  return _impl_.cancel_;
+}
+inline bool SessionRequest::cancel() const {
+  // @@protoc_insertion_point(field_get:proto.SessionRequest.cancel)
+  return _internal_cancel();
+}
+inline void SessionRequest::_internal_set_cancel(bool value) {
   
-  return message_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.cancel_ = value;
 }
-inline std::string* JobResult::release_message() {
-  // @@protoc_insertion_point(field_release:proto.JobResult.message)
+inline void SessionRequest::set_cancel(bool value) {
+  _internal_set_cancel(value);
+  // @@protoc_insertion_point(field_set:proto.SessionRequest.cancel)
+}
+
+// -------------------------------------------------------------------
+
+// SessionResult
+
+// uint64 correlation_id = 1;
+inline void SessionResult::clear_correlation_id() {
+  _impl_.correlation_id_ = uint64_t{0u};
+}
+inline uint64_t SessionResult::_internal_correlation_id() const {
+  return _impl_.correlation_id_;
+}
+inline uint64_t SessionResult::correlation_id() const {
+  // @@protoc_insertion_point(field_get:proto.SessionResult.correlation_id)
+  return _internal_correlation_id();
+}
+inline void SessionResult::_internal_set_correlation_id(uint64_t value) {
   
-  return message_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.correlation_id_ = value;
 }
-inline void JobResult::set_allocated_message(std::string* message) {
-  if (message != nullptr) {
+inline void SessionResult::set_correlation_id(uint64_t value) {
+  _internal_set_correlation_id(value);
+  // @@protoc_insertion_point(field_set:proto.SessionResult.correlation_id)
+}
+
+// .proto.JobResult result = 2;
+inline bool SessionResult::_internal_has_result() const {
+  return this != internal_default_instance() && _impl_.result_ != nullptr;
+}
+inline bool SessionResult::has_result() const {
+  return _internal_has_result();
+}
+inline void SessionResult::clear_result() {
+  if (GetArenaForAllocation() == nullptr && _impl_.result_ != nullptr) {
+    delete _impl_.result_;
+  }
+  _impl_.result_ = nullptr;
+}
+inline const ::proto::JobResult& SessionResult::_internal_result() const {
+  const ::proto::JobResult* p = _impl_.result_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto::JobResult&>(
+      ::proto::_JobResult_default_instance_);
+}
+inline const ::proto::JobResult& SessionResult::result() const {
+  // @@protoc_insertion_point(field_get:proto.SessionResult.result)
+  return _internal_result();
+}
+inline void SessionResult::unsafe_arena_set_allocated_result(
+    ::proto::JobResult* result) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.result_);
+  }
+  _impl_.result_ = result;
+  if (result) {
     
   } else {
     
   }
-  message_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), message);
-  // @@protoc_insertion_point(field_set_allocated:proto.JobResult.message)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto.SessionResult.result)
+}
+inline ::proto::JobResult* SessionResult::release_result() {
+  
+  ::proto::JobResult* temp = _impl_.result_;
+  _impl_.result_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::proto::JobResult* SessionResult::unsafe_arena_release_result() {
+  // @@protoc_insertion_point(field_release:proto.SessionResult.result)
+  
+  ::proto::JobResult* temp = _impl_.result_;
+  _impl_.result_ = nullptr;
+  return temp;
+}
+inline ::proto::JobResult* SessionResult::_internal_mutable_result() {
+  
+  if (_impl_.result_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto::JobResult>(GetArenaForAllocation());
+    _impl_.result_ = p;
+  }
+  return _impl_.result_;
+}
+inline ::proto::JobResult* SessionResult::mutable_result() {
+  ::proto::JobResult* _msg = _internal_mutable_result();
+  // @@protoc_insertion_point(field_mutable:proto.SessionResult.result)
+  return _msg;
+}
+inline void SessionResult::set_allocated_result(::proto::JobResult* result) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.result_;
+  }
+  if (result) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(result);
+    if (message_arena != submessage_arena) {
+      result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, result, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.result_ = result;
+  // @@protoc_insertion_point(field_set_allocated:proto.SessionResult.result)
+}
+
+// int32 status_code = 3;
+inline void SessionResult::clear_status_code() {
+  _impl_.status_code_ = 0;
+}
+inline int32_t SessionResult::_internal_status_code() const {
+  return _impl_.status_code_;
+}
+inline int32_t SessionResult::status_code() const {
+  // @@protoc_insertion_point(field_get:proto.SessionResult.status_code)
+  return _internal_status_code();
+}
+inline void SessionResult::_internal_set_status_code(int32_t value) {
+  
+  _impl_.status_code_ = value;
+}
+inline void SessionResult::set_status_code(int32_t value) {
+  _internal_set_status_code(value);
+  // @@protoc_insertion_point(field_set:proto.SessionResult.status_code)
+}
+
+// string status_message = 4;
+inline void SessionResult::clear_status_message() {
+  _impl_.status_message_.ClearToEmpty();
+}
+inline const std::string& SessionResult::status_message() const {
+  // @@protoc_insertion_point(field_get:proto.SessionResult.status_message)
+  return _internal_status_message();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SessionResult::set_status_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.status_message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:proto.SessionResult.status_message)
+}
+inline std::string* SessionResult::mutable_status_message() {
+  std::string* _s = _internal_mutable_status_message();
+  // @@protoc_insertion_point(field_mutable:proto.SessionResult.status_message)
+  return _s;
+}
+inline const std::string& SessionResult::_internal_status_message() const {
+  return _impl_.status_message_.Get();
+}
+inline void SessionResult::_internal_set_status_message(const std::string& value) {
+  
+  _impl_.status_message_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SessionResult::_internal_mutable_status_message() {
+  
+  return _impl_.status_message_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SessionResult::release_status_message() {
+  // @@protoc_insertion_point(field_release:proto.SessionResult.status_message)
+  return _impl_.status_message_.Release();
+}
+inline void SessionResult::set_allocated_status_message(std::string* status_message) {
+  if (status_message != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.status_message_.SetAllocated(status_message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.status_message_.IsDefault()) {
+    _impl_.status_message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto.SessionResult.status_message)
 }
 
 // -------------------------------------------------------------------
@@ -1813,6 +3471,16 @@ inline void JobResult::set_allocated_message(std::string* message) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
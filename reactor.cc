@@ -0,0 +1,152 @@
+#include "reactor.h"
+#include <cerrno>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// Number of threads which run blocking file I/O.
+static const int IO_THREADS = 4;
+
+// Interval in which processes are polled if pidfds are not supported.
+static const std::chrono::milliseconds PROCESS_POLL_INTERVAL(10);
+
+// open_pidfd returns a file descriptor which becomes readable once the
+// process has exited or -1 if the kernel does not support it.
+static int open_pidfd(pid_t pid) {
+#ifdef SYS_pidfd_open
+    return syscall(SYS_pidfd_open, pid, 0);
+#else
+    return -1;
+#endif
+}
+
+Reactor& Reactor::Instance() {
+    static Reactor reactor;
+    return reactor;
+}
+
+Reactor::Reactor() : stopping(false), io_pool(IO_THREADS) {
+    if (pipe(wake_fds) == 0) {
+        fcntl(wake_fds[0], F_SETFL, O_NONBLOCK);
+        fcntl(wake_fds[1], F_SETFL, O_NONBLOCK);
+    }
+    thread = std::thread(&Reactor::Run, this);
+}
+
+Reactor::~Reactor() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    Wake();
+    thread.join();
+    close(wake_fds[0]);
+    close(wake_fds[1]);
+}
+
+void Reactor::AddTimer(std::chrono::steady_clock::time_point deadline, std::function<void()> callback) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        Timer timer = { deadline, std::move(callback) };
+        timers.push(std::move(timer));
+    }
+    Wake();
+}
+
+void Reactor::WatchProcess(pid_t pid, std::function<void(int)> callback) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        Process process = { open_pidfd(pid), std::move(callback) };
+        processes[pid] = std::move(process);
+    }
+    Wake();
+}
+
+void Reactor::KillProcess(pid_t pid) {
+    // Processes are reaped under the same lock.
+    std::lock_guard<std::mutex> lock(mutex);
+    if (processes.find(pid) != processes.end()) {
+        kill(pid, SIGKILL);
+    }
+}
+
+void Reactor::RunBlocking(std::function<void()> work) {
+    io_pool.Submit(std::move(work));
+}
+
+void Reactor::Wake() {
+    char c = 0;
+    ssize_t ignored = write(wake_fds[1], &c, 1);
+    (void)ignored;
+}
+
+void Reactor::Run() {
+    std::vector<pollfd> fds;
+    for (;;) {
+        std::vector<std::function<void()>> due;
+        std::vector<std::pair<std::function<void(int)>, int>> exited;
+        int timeout = -1;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (stopping) {
+                return;
+            }
+
+            // Collect expired timers.
+            auto now = std::chrono::steady_clock::now();
+            while (!timers.empty() && timers.top().deadline <= now) {
+                due.push_back(timers.top().callback);
+                timers.pop();
+            }
+            if (!timers.empty()) {
+                auto wait = std::chrono::duration_cast<std::chrono::milliseconds>(timers.top().deadline - now);
+                timeout = wait.count() + 1;
+            }
+
+            // Reap exited processes.
+            fds.clear();
+            pollfd wake = { wake_fds[0], POLLIN, 0 };
+            fds.push_back(wake);
+            for (auto it = processes.begin(); it != processes.end();) {
+                int status = 0;
+                pid_t result = waitpid(it->first, &status, WNOHANG);
+                if (result != 0) {
+                    if (result < 0) {
+                        status = -1;
+                    }
+                    exited.push_back(std::make_pair(std::move(it->second.callback), status));
+                    if (it->second.pidfd >= 0) {
+                        close(it->second.pidfd);
+                    }
+                    it = processes.erase(it);
+                    continue;
+                }
+                if (it->second.pidfd >= 0) {
+                    pollfd process = { it->second.pidfd, POLLIN, 0 };
+                    fds.push_back(process);
+                } else if (timeout < 0 || timeout > PROCESS_POLL_INTERVAL.count()) {
+                    timeout = PROCESS_POLL_INTERVAL.count();
+                }
+                ++it;
+            }
+        }
+
+        if (!due.empty() || !exited.empty()) {
+            for (auto & callback : due) {
+                callback();
+            }
+            for (auto & process : exited) {
+                process.first(process.second);
+            }
+            continue;
+        }
+
+        if (poll(fds.data(), fds.size(), timeout) > 0 && (fds[0].revents & POLLIN)) {
+            char buffer[64];
+            while (read(wake_fds[0], buffer, sizeof(buffer)) > 0) {}
+        }
+    }
+}
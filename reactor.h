@@ -0,0 +1,70 @@
+#ifndef REACTOR_H
+#define REACTOR_H
+
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+#include <sys/types.h>
+#include "executor.h"
+
+// Reactor waits for timers and child processes on a single thread and
+// runs blocking file I/O on a small pool of its own. Jobs which wait
+// for these events therefore do not hold an executor thread.
+// Callbacks run on the reactor or I/O threads and must be short.
+class Reactor {
+    public:
+        // Instance returns the process wide reactor. It is started on
+        // first use.
+        static Reactor& Instance();
+
+        ~Reactor();
+
+        // AddTimer calls callback once the deadline has passed.
+        void AddTimer(std::chrono::steady_clock::time_point deadline, std::function<void()> callback);
+
+        // WatchProcess reaps the given child process once it has exited
+        // and calls callback with its wait status, or with -1 if the
+        // process is not a child of this process.
+        void WatchProcess(pid_t pid, std::function<void(int)> callback);
+
+        // KillProcess sends SIGKILL to the given watched process unless it
+        // has been reaped already, since its pid may have been reused then.
+        void KillProcess(pid_t pid);
+
+        // RunBlocking runs work on the I/O pool.
+        void RunBlocking(std::function<void()> work);
+
+    private:
+        struct Timer {
+            std::chrono::steady_clock::time_point deadline;
+            std::function<void()> callback;
+
+            bool operator>(const Timer& other) const {
+                return deadline > other.deadline;
+            }
+        };
+
+        struct Process {
+            int pidfd;
+            std::function<void(int)> callback;
+        };
+
+        std::mutex mutex;
+        std::priority_queue<Timer, std::vector<Timer>, std::greater<Timer>> timers;
+        std::map<pid_t, Process> processes;
+        int wake_fds[2];
+        bool stopping;
+        std::thread thread;
+        JobExecutor io_pool;
+
+        Reactor();
+        void Wake();
+        void Run();
+};
+
+#endif
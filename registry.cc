@@ -0,0 +1,94 @@
+#include "registry.h"
+#include <cstdio>
+#include <grpcpp/support/slice.h>
+
+// Error messages
+const std::string ERR_DUPLICATE_JOB = "duplicate job found (two jobs with the same title)";
+static const std::string ERR_ID_COLLISION = "job id collision, rename one of the jobs";
+
+// 64 bit FNV-1a parameters of the etag hash.
+static const uint64_t FNV_OFFSET_BASIS = 14695981039346656037ull;
+static const uint64_t FNV_PRIME = 1099511628211ull;
+
+// fnv_add mixes the given bytes into the hash.
+static uint64_t fnv_add(uint64_t hash, const char* data, size_t size) {
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= (unsigned char)data[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+// collision_error describes two jobs with the same id.
+static std::string collision_error(const gaia::job_wrapper& first, const gaia::job_wrapper& second) {
+    if (first.job.title() == second.job.title()) {
+        return ERR_DUPLICATE_JOB + ": '" + first.job.title() + "'";
+    }
+    return ERR_ID_COLLISION + ": '" + first.job.title() + "' and '" + second.job.title() + "'";
+}
+
+// Empty tables with free slots only, so Find works before Build.
+JobRegistry::JobRegistry() : table(2, Entry{0, FREE}), table64(2, Entry{0, FREE}), mask(1), shift(63) {}
+
+void JobRegistry::Add(gaia::job_wrapper&& job) {
+    jobs.push_back(std::move(job));
+}
+
+int32_t JobRegistry::Insert(std::vector<Entry>& entries, uint64_t id, int32_t index) {
+    size_t slot = Slot(id);
+    while (entries[slot].index != FREE) {
+        if (entries[slot].id == id) {
+            int32_t other = entries[slot].index;
+            entries[slot].index = AMBIGUOUS;
+            return other;
+        }
+        slot = (slot + 1) & mask;
+    }
+    entries[slot].id = id;
+    entries[slot].index = index;
+    return FREE;
+}
+
+void JobRegistry::Build(bool wide_ids) GAIA_THROWS {
+    // Keep the load factor at or below one half.
+    int bits = 1;
+    while (((size_t)1 << bits) < jobs.size() * 2) {
+        ++bits;
+    }
+    table.assign((size_t)1 << bits, Entry{0, FREE});
+    table64.assign(table.size(), Entry{0, FREE});
+    mask = table.size() - 1;
+    shift = 64 - bits;
+
+    // Every collision of the 64 bit ids is fatal. Colliding 32 bit ids
+    // are only left unresolved if Gaia uses the 64 bit ones.
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        int32_t other = Insert(table64, jobs[i].job.unique_id64(), i);
+        if (other != FREE) {
+            throw collision_error(jobs[other], jobs[i]);
+        }
+        other = Insert(table, jobs[i].job.unique_id(), i);
+        if (other != FREE && !wide_ids) {
+            throw collision_error(jobs[other], jobs[i]);
+        }
+    }
+
+    // Serialize every job once. GetJobs only hands out references to
+    // these buffers. The etag covers the length of every job as well, so
+    // moving bytes between jobs changes it.
+    serialized.clear();
+    serialized.reserve(jobs.size());
+    uint64_t hash = FNV_OFFSET_BASIS;
+    for (auto const& job : jobs) {
+        std::string bytes;
+        job.job.SerializeToString(&bytes);
+        uint64_t size = bytes.size();
+        hash = fnv_add(hash, reinterpret_cast<const char*>(&size), sizeof(size));
+        hash = fnv_add(hash, bytes.data(), bytes.size());
+        grpc::Slice slice(bytes);
+        serialized.push_back(grpc::ByteBuffer(&slice, 1));
+    }
+    char hex[17];
+    std::snprintf(hex, sizeof(hex), "%016llx", (unsigned long long)hash);
+    etag = hex;
+}
@@ -0,0 +1,97 @@
+#ifndef REGISTRY_H
+#define REGISTRY_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <grpcpp/support/byte_buffer.h>
+#include "sdk.h"
+
+// ERR_DUPLICATE_JOB is reported for two jobs with the same title.
+extern const std::string ERR_DUPLICATE_JOB;
+
+// JobRegistry maps job ids to the cached jobs of the plugin.
+// It is built once in Serve before the server starts and never changes
+// afterwards, so lookups from concurrent rpcs need no locking.
+// Lookups use flat open addressing tables with linear probing, one for
+// the 32 bit and one for the 64 bit ids.
+class JobRegistry {
+    public:
+        JobRegistry();
+
+        // Add moves the given job into the registry.
+        void Add(gaia::job_wrapper&& job);
+
+        // Build creates the lookup tables for all added jobs and
+        // serializes every job once. Throws if two jobs have the same 64
+        // bit id. Jobs whose 32 bit ids collide can only be found by their
+        // 64 bit id if wide_ids is set, otherwise Build throws as well.
+        void Build(bool wide_ids) GAIA_THROWS;
+
+        // Find returns the job with the given 32 bit id or nullptr.
+        const gaia::job_wrapper* Find(uint32_t id) const {
+            return Lookup(table, id);
+        }
+
+        // Find64 returns the job with the given 64 bit id or nullptr.
+        const gaia::job_wrapper* Find64(uint64_t id) const {
+            return Lookup(table64, id);
+        }
+
+        // Jobs returns all jobs in the order they have been added.
+        const std::vector<gaia::job_wrapper>& Jobs() const {
+            return jobs;
+        }
+
+        // Serialized returns the wire format of all jobs in the order
+        // they have been added.
+        const std::vector<grpc::ByteBuffer>& Serialized() const {
+            return serialized;
+        }
+
+        // Etag returns a hash of the serialized jobs. It only changes if
+        // the jobs do, so clients can tell whether their copy is current.
+        const std::string& Etag() const {
+            return etag;
+        }
+
+    private:
+        struct Entry {
+            uint64_t id;
+            int32_t index;
+        };
+
+        // Entry indexes of free slots and of ids shared by several jobs.
+        static const int32_t FREE = -1;
+        static const int32_t AMBIGUOUS = -2;
+
+        std::vector<gaia::job_wrapper> jobs;
+        std::vector<grpc::ByteBuffer> serialized;
+        std::string etag;
+        std::vector<Entry> table;
+        std::vector<Entry> table64;
+        size_t mask;
+        int shift;
+
+        // Slot spreads the id over the table with fibonacci hashing.
+        size_t Slot(uint64_t id) const {
+            return (id * 11400714819323198485ull) >> shift;
+        }
+
+        const gaia::job_wrapper* Lookup(const std::vector<Entry>& entries, uint64_t id) const {
+            size_t slot = Slot(id);
+            while (entries[slot].index != FREE) {
+                if (entries[slot].id == id) {
+                    return entries[slot].index >= 0 ? &jobs[entries[slot].index] : nullptr;
+                }
+                slot = (slot + 1) & mask;
+            }
+            return nullptr;
+        }
+
+        // Insert adds the job at the given index to the table. Returns
+        // the index of the job which already has the id, or FREE.
+        int32_t Insert(std::vector<Entry>& entries, uint64_t id, int32_t index);
+};
+
+#endif
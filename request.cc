@@ -0,0 +1,114 @@
+#include <climits>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite.h>
+#include "request.h"
+
+using google::protobuf::io::CodedInputStream;
+using google::protobuf::internal::WireFormatLite;
+
+// Field numbers shared by Job and ExecuteRequest, and of Argument.
+static const int FIELD_UNIQUE_ID = 1;
+static const int FIELD_ARGS = 5;
+static const int FIELD_UNIQUE_ID64 = 7;
+static const int FIELD_ARG_KEY = 3;
+static const int FIELD_ARG_VALUE = 4;
+
+static const uint32_t TAG_UNIQUE_ID = WireFormatLite::MakeTag(FIELD_UNIQUE_ID, WireFormatLite::WIRETYPE_VARINT);
+static const uint32_t TAG_UNIQUE_ID64 = WireFormatLite::MakeTag(FIELD_UNIQUE_ID64, WireFormatLite::WIRETYPE_VARINT);
+static const uint32_t TAG_ARGS = WireFormatLite::MakeTag(FIELD_ARGS, WireFormatLite::WIRETYPE_LENGTH_DELIMITED);
+static const uint32_t TAG_ARG_KEY = WireFormatLite::MakeTag(FIELD_ARG_KEY, WireFormatLite::WIRETYPE_LENGTH_DELIMITED);
+static const uint32_t TAG_ARG_VALUE = WireFormatLite::MakeTag(FIELD_ARG_VALUE, WireFormatLite::WIRETYPE_LENGTH_DELIMITED);
+
+// read_bytes references the next length delimited field in place.
+static bool read_bytes(CodedInputStream& input, grpc::string_ref& bytes) {
+    uint32_t length;
+    if (!input.ReadVarint32(&length)) {
+        return false;
+    }
+    if (length == 0) {
+        bytes = grpc::string_ref();
+        return true;
+    }
+    const void* data;
+    int available;
+    if (!input.GetDirectBufferPointer(&data, &available) || (uint32_t)available < length) {
+        return false;
+    }
+    bytes = grpc::string_ref(static_cast<const char*>(data), length);
+    return input.Skip(length);
+}
+
+// read_argument decodes the key and value of an Argument.
+static bool read_argument(CodedInputStream& input, gaia::argument_ref& arg) {
+    uint32_t length;
+    if (!input.ReadVarint32(&length) || length > INT_MAX) {
+        return false;
+    }
+    CodedInputStream::Limit limit = input.PushLimit(length);
+    while (input.BytesUntilLimit() > 0) {
+        uint32_t tag = input.ReadTag();
+        bool ok;
+        if (tag == TAG_ARG_KEY) {
+            ok = read_bytes(input, arg.key);
+        } else if (tag == TAG_ARG_VALUE) {
+            ok = read_bytes(input, arg.value);
+        } else {
+            ok = tag != 0 && WireFormatLite::SkipField(&input, tag);
+        }
+        if (!ok) {
+            return false;
+        }
+    }
+    input.PopLimit(limit);
+    return true;
+}
+
+JobRequest::JobRequest() : id(0), id64(0) {}
+
+bool JobRequest::Parse(grpc::ByteBuffer* buffer) {
+    slices.clear();
+    joined.clear();
+    if (!buffer->Dump(&slices).ok()) {
+        return false;
+    }
+    buffer->Clear();
+
+    // Requests mostly arrive in a single slice, which is referenced as
+    // is. Others are joined once.
+    if (slices.size() == 1) {
+        return Parse(reinterpret_cast<const char*>(slices[0].begin()), slices[0].size());
+    }
+    for (auto const& slice : slices) {
+        joined.append(reinterpret_cast<const char*>(slice.begin()), slice.size());
+    }
+    slices.clear();
+    return Parse(joined.data(), joined.size());
+}
+
+bool JobRequest::Parse(const char* data, size_t size) {
+    id = 0;
+    id64 = 0;
+    args.clear();
+    if (size > INT_MAX) {
+        return false;
+    }
+    CodedInputStream input(reinterpret_cast<const uint8_t*>(data), (int)size);
+    while (input.BytesUntilLimit() > 0) {
+        uint32_t tag = input.ReadTag();
+        bool ok;
+        if (tag == TAG_UNIQUE_ID) {
+            ok = input.ReadVarint32(&id);
+        } else if (tag == TAG_UNIQUE_ID64) {
+            ok = input.ReadVarint64(&id64);
+        } else if (tag == TAG_ARGS) {
+            args.push_back(gaia::argument_ref());
+            ok = read_argument(input, args.back());
+        } else {
+            ok = tag != 0 && WireFormatLite::SkipField(&input, tag);
+        }
+        if (!ok) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,49 @@
+#ifndef REQUEST_H
+#define REQUEST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <grpcpp/support/byte_buffer.h>
+#include <grpcpp/support/slice.h>
+#include "sdk.h"
+
+// JobRequest is an execution request decoded straight from its wire
+// format. Only the job ids and the key and value of every argument are
+// read, all other fields are skipped, and keys and values point into the
+// received bytes instead of being copied. Job and ExecuteRequest share
+// these field numbers, so both decode alike.
+class JobRequest {
+    public:
+        JobRequest();
+
+        // Parse takes over the bytes of the given buffer and decodes them.
+        // Returns false if they are no valid request.
+        bool Parse(grpc::ByteBuffer* buffer);
+
+        // Parse decodes the given bytes, which must outlive the request.
+        bool Parse(const char* data, size_t size);
+
+        uint32_t unique_id() const {
+            return id;
+        }
+
+        uint64_t unique_id64() const {
+            return id64;
+        }
+
+        // Arguments returns the arguments in the order of the request.
+        const std::vector<gaia::argument_ref>& Arguments() const {
+            return args;
+        }
+
+    private:
+        std::vector<grpc::Slice> slices;
+        std::string joined;
+        uint32_t id;
+        uint64_t id64;
+        std::vector<gaia::argument_ref> args;
+};
+
+#endif
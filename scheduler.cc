@@ -0,0 +1,70 @@
+#include <algorithm>
+#include "scheduler.h"
+
+JobScheduler::JobScheduler(const std::vector<std::vector<size_t>>& dependencies, const std::vector<double>& costs)
+    : dependents(dependencies.size()), waiting_for(dependencies.size()), rank(costs),
+      ready(Order{&rank}), running(0), stopped(false) {
+    for (size_t i = 0; i < dependencies.size(); ++i) {
+        waiting_for[i] = dependencies[i].size();
+        for (size_t dependency : dependencies[i]) {
+            dependents[dependency].push_back(i);
+        }
+    }
+
+    // Rank the jobs in reverse topological order, every job after all
+    // of its dependents. Jobs on a cycle keep their own cost.
+    std::vector<size_t> pending(dependencies.size());
+    std::vector<size_t> order;
+    for (size_t i = 0; i < dependencies.size(); ++i) {
+        pending[i] = dependents[i].size();
+        if (pending[i] == 0) {
+            order.push_back(i);
+        }
+    }
+    for (size_t next = 0; next < order.size(); ++next) {
+        size_t job = order[next];
+        double longest = 0;
+        for (size_t dependent : dependents[job]) {
+            longest = std::max(longest, rank[dependent]);
+        }
+        rank[job] += longest;
+        for (size_t dependency : dependencies[job]) {
+            if (--pending[dependency] == 0) {
+                order.push_back(dependency);
+            }
+        }
+    }
+
+    for (size_t i = 0; i < dependencies.size(); ++i) {
+        if (waiting_for[i] == 0) {
+            ready.push(i);
+        }
+    }
+}
+
+void JobScheduler::Next(std::vector<size_t>& next, size_t limit) {
+    next.clear();
+    while (!stopped && !ready.empty() && running < limit) {
+        next.push_back(ready.top());
+        ready.pop();
+        ++running;
+    }
+}
+
+void JobScheduler::Finished(size_t index, bool succeeded) {
+    --running;
+    if (!succeeded) {
+        Stop();
+        return;
+    }
+    for (size_t dependent : dependents[index]) {
+        if (--waiting_for[dependent] == 0) {
+            ready.push(dependent);
+        }
+    }
+}
+
+void JobScheduler::Stop() {
+    stopped = true;
+    ready = std::priority_queue<size_t, std::vector<size_t>, Order>(Order{&rank});
+}
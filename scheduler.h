@@ -0,0 +1,62 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <cstddef>
+#include <queue>
+#include <utility>
+#include <vector>
+
+// JobScheduler orders the execution of a batch of jobs. A job becomes
+// ready once all its dependencies within the batch have succeeded, so
+// independent jobs can run in parallel. After the first failure no job
+// becomes ready anymore.
+// Ready jobs are started by their longest remaining path through the
+// batch, the estimated duration of the job plus its slowest chain of
+// dependents, so the critical path never waits behind short jobs.
+// It is not thread safe: a single thread reports finished jobs and
+// starts the jobs it returns.
+class JobScheduler {
+    public:
+        // dependencies holds the indexes of the jobs every job waits for,
+        // costs the estimated duration of every job.
+        JobScheduler(const std::vector<std::vector<size_t>>& dependencies, const std::vector<double>& costs);
+
+        // Next moves the ready jobs which should be started now into
+        // ready, most critical first, and counts them as running. At most
+        // limit jobs run at the same time, so ready jobs keep their order
+        // instead of queueing up in the executor.
+        void Next(std::vector<size_t>& ready, size_t limit);
+
+        // Finished marks a running job as done.
+        void Finished(size_t index, bool succeeded);
+
+        // Stop makes sure no further job is started.
+        void Stop();
+
+        // Done returns true once no job runs and none can be started.
+        bool Done() const {
+            return running == 0 && (stopped || ready.empty());
+        }
+
+    private:
+        // Ready jobs ordered by rank, ties in batch order.
+        struct Order {
+            const std::vector<double>* rank;
+
+            bool operator()(size_t a, size_t b) const {
+                if ((*rank)[a] != (*rank)[b]) {
+                    return (*rank)[a] < (*rank)[b];
+                }
+                return a > b;
+            }
+        };
+
+        std::vector<std::vector<size_t>> dependents;
+        std::vector<size_t> waiting_for;
+        std::vector<double> rank;
+        std::priority_queue<size_t, std::vector<size_t>, Order> ready;
+        size_t running;
+        bool stopped;
+};
+
+#endif
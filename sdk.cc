@@ -2,25 +2,67 @@
 #include <iostream>
 #include <memory>
 #include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <climits>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
 #include <cstdlib>
+#include <deque>
 #include <fstream>
+#include <functional>
+#include <future>
+#include <map>
 #include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <mutex>
+#include <poll.h>
+#include <sys/wait.h>
+#include <unistd.h>
 #include <grpcpp/grpcpp.h>
 #include <grpcpp/health_check_service_interface.h>
+#include <grpcpp/resource_quota.h>
 #include "plugin.grpc.pb.h"
 #include "sdk.h"
+#include "executor.h"
+#include "registry.h"
+#include "reactor.h"
+#include "logbuffer.h"
+#include "scheduler.h"
+#include "history.h"
+#include "cgroup.h"
+#include "env.h"
+#include "admission.h"
+#include "limiter.h"
+#include "request.h"
+#include "health.h"
+#include "job_semaphores.h"
+#include "arena_pool.h"
 
 using std::string;
 using std::unique_ptr;
 using grpc::Server;
 using grpc::ServerBuilder;
+using grpc::ServerAsyncResponseWriter;
+using grpc::ServerAsyncWriter;
+using grpc::ServerCompletionQueue;
 using grpc::ServerContext;
+using grpc::ServerReaderWriter;
 using grpc::ServerWriter;
 using grpc::Status;
 using proto::Plugin;
 using proto::Empty;
 using proto::Job;
 using proto::JobResult;
+using proto::JobOutput;
+using proto::JobBatch;
+using proto::ExecuteRequest;
+using proto::SessionRequest;
+using proto::SessionResult;
 using proto::Argument;
 using proto::ManualInteraction;
 
@@ -28,103 +70,937 @@ using proto::ManualInteraction;
 static const string SERVER_CERT_ENV = "GAIA_PLUGIN_CERT";
 static const string SERVER_KEY_ENV = "GAIA_PLUGIN_KEY";
 static const string ROOT_CA_CERT_ENV = "GAIA_PLUGIN_CA_CERT";
+static const string SERVER_MODE_ENV = "GAIA_PLUGIN_SERVER_MODE";
+static const string CQ_COUNT_ENV = "GAIA_PLUGIN_CQ_COUNT";
+static const string CQ_POLLERS_ENV = "GAIA_PLUGIN_CQ_POLLERS";
+static const string EXECUTOR_THREADS_ENV = "GAIA_PLUGIN_EXECUTOR_THREADS";
+static const string LOG_BUFFER_SIZE_ENV = "GAIA_PLUGIN_LOG_BUFFER_SIZE";
+static const string JOB_HISTORY_ENV = "GAIA_PLUGIN_JOB_HISTORY";
+static const string NETWORK_ENV = "GAIA_PLUGIN_NETWORK";
+static const string MAX_RUNNING_JOBS_ENV = "GAIA_PLUGIN_MAX_RUNNING_JOBS";
+static const string MAX_QUEUED_JOBS_ENV = "GAIA_PLUGIN_MAX_QUEUED_JOBS";
+static const string ADAPTIVE_CONCURRENCY_ENV = "GAIA_PLUGIN_ADAPTIVE_CONCURRENCY";
+static const string HEALTH_INTERVAL_ENV = "GAIA_PLUGIN_HEALTH_INTERVAL_MS";
+static const string HEALTH_MAX_SATURATION_ENV = "GAIA_PLUGIN_HEALTH_MAX_SATURATION";
+static const string HEALTH_MAX_MEMORY_ENV = "GAIA_PLUGIN_HEALTH_MAX_MEMORY";
+static const string HEALTH_MAX_QUEUED_JOBS_ENV = "GAIA_PLUGIN_HEALTH_MAX_QUEUED_JOBS";
+static const string RESOURCES_ENV = "GAIA_PLUGIN_RESOURCES";
+static const string UNIX_SOCKET_DIR_ENV = "PLUGIN_UNIX_SOCKET_DIR";
+static const string PROTOCOL_VERSIONS_ENV = "PLUGIN_PROTOCOL_VERSIONS";
+static const string SERVER_MODE_ASYNC = "async";
+static const string RESOURCE_QUOTA_NAME = "gaia-plugin";
+static const string HEALTH_SERVICE = "plugin";
+static const string HEALTH_SERVICE_LIMITER = "plugin.limiter";
+static const string HEALTH_SERVICE_JOB_PREFIX = "plugin/";
+
+// Interval in which a waiting sync call checks if it has been cancelled.
+static const std::chrono::milliseconds CANCEL_POLL_INTERVAL(50);
+
+// Longest interval in which WaitProcess checks a child process.
+static const std::chrono::milliseconds PROCESS_POLL_MAX_INTERVAL(50);
+
+// Default size of the log buffer of a streamed job and the largest
+// log chunk sent in a single message.
+static const int DEFAULT_LOG_BUFFER_SIZE = 1 << 20;
+static const size_t LOG_CHUNK_SIZE = 64 * 1024;
+
+// Idle poller threads the synchronous server keeps at least, the gRPC default.
+static const int DEFAULT_SYNC_MAX_POLLERS = 2;
+
+// Jobs which may wait for a free slot. Further calls are rejected, Gaia
+// retries them later.
+static const int DEFAULT_MAX_QUEUED_JOBS = 64;
+
+// The health monitor samples the load once per interval. The plugin stops
+// serving once its executor has twice as many tasks as threads, memory is
+// almost used up or the admission queue is half full.
+static const int DEFAULT_HEALTH_INTERVAL_MS = 1000;
+static const int DEFAULT_HEALTH_MAX_SATURATION = 200;
+static const int DEFAULT_HEALTH_MAX_MEMORY = 90;
 static const string LISTEN_ADDRESS = "127.0.0.1";
 static const int CORE_PROTOCOL_VERSION = 1;
+// Protocol versions the plugin speaks. Version 3 adds the Execute and
+// Session methods, version 4 64 bit job ids. Gaia versions which do not
+// announce a newer one get version 2.
 static const int PROTOCOL_VERSION = 2;
+static const int WIDE_ID_PROTOCOL_VERSION = 4;
+static const int LATEST_PROTOCOL_VERSION = 4;
 static const string PROTOCOL_TYPE = "grpc";
 static const string PROTOCOL_NETWORK = "tcp";
+static const string PROTOCOL_NETWORK_UNIX = "unix";
+static const string SOCKET_NAME = "plugin.sock";
 
-// FNV hash constants
-static const unsigned int FNV_PRIME = 16777619u;
-static const unsigned int OFFSET_BASIS = 2166136261u;
+// Metadata key of the etag of the job list in GetJobs.
+static const string JOBS_ETAG_METADATA = "gaia-jobs-etag";
 
 // Error messages
 static const string ERR_JOB_NOT_FOUND = "job not found in plugin";
 static const string ERR_EXIT_PIPELINE = "pipeline exit requested by job";
-static const string ERR_DUPLICATE_JOB = "duplicate job found (two jobs with the same title)";
+static const string ERR_UNEXPECTED = "unexpected error in job handler";
+static const string ERR_JOB_CANCELLED = "job execution has been cancelled";
+static const string ERR_DUPLICATE_BATCH_JOB = "job requested twice in batch";
+static const string ERR_JOB_SKIPPED = "job skipped after a failed job of the batch";
+static const string ERR_DUPLICATE_CORRELATION_ID = "correlation id already in use by a running job";
+static const string ERR_SERVER_START = "cannot start plugin server on network ";
+static const string ERR_ADMISSION_QUEUE_FULL = "too many jobs waiting for execution";
+static const string ERR_INVALID_REQUEST = "cannot decode job request";
+
+// job_context is the state of a running job which its handler reaches
+// through the SDK functions. log is only set for streamed executions.
+struct job_context {
+    gaia::cancellation_token token;
+    std::shared_ptr<LogBuffer> log;
+};
 
-class GRPCPluginImpl final : public Plugin::Service {
+// The context of the job running on this thread.
+static thread_local const job_context* current_job = nullptr;
+
+// JobScope makes the given context the current one while it lives.
+class JobScope {
     public:
-        Status GetJobs(ServerContext* context, const Empty* request, ServerWriter<Job>* writer) {
-            // Iterate over all jobs and send every job to client (e.g. Gaia).
-            for (auto const& job : cached_jobs) {
-                writer->Write(job.job);
-            }
-            return Status::OK;
+        explicit JobScope(const job_context& context) : previous(current_job) {
+            current_job = &context;
         }
 
-        Status ExecuteJob(ServerContext* context, const Job* request, JobResult* response) {
-            gaia::job_wrapper * job = GetJob((*request));
-            if (job == nullptr) {
-                return Status(grpc::StatusCode::CANCELLED, ERR_JOB_NOT_FOUND);
-            }
+        ~JobScope() {
+            current_job = previous;
+        }
+
+    private:
+        const job_context* previous;
+};
+
+#ifdef GAIA_COROUTINES
+// current_context returns the context of the job running on this thread.
+static job_context current_context() {
+    return current_job == nullptr ? job_context() : (*current_job);
+}
+#endif
+
+// reference_arguments references the request arguments in place. The
+// execution helpers take either a full Job or a slim ExecuteRequest, both
+// carry the job id and the arguments, which is all execution reads.
+template <typename Request>
+static std::vector<gaia::argument_ref> reference_arguments(const Request& request) {
+    std::vector<gaia::argument_ref> refs;
+    refs.reserve(request.args_size());
+    for (auto const& arg : request.args()) {
+        gaia::argument_ref ref = { arg.key(), arg.value() };
+        refs.push_back(ref);
+    }
+    return refs;
+}
+
+static std::vector<gaia::argument_ref> reference_arguments(const JobRequest& request) {
+    return request.Arguments();
+}
+
+// set_job_error stores the error thrown by a job in the response.
+static void set_job_error(const gaia::job_wrapper& job, const string& e, JobResult* response) {
+    // Check if job wants to force exit pipeline.
+    // We will exit the pipeline but not mark as 'failed'.
+    if (e.compare(ERR_EXIT_PIPELINE) != 0) {
+       response->set_failed(true);
+    }
+
+    // Set log message and job id.
+    response->set_exit_pipeline(true);
+    response->set_message(e);
+    response->set_unique_id(job.job.unique_id());
+    response->set_unique_id64(job.job.unique_id64());
+}
+
+// run_job transforms the request arguments and executes the job handler.
+template <typename Request>
+static void run_job(const gaia::job_wrapper& job, const Request& request, JobResult* response, const job_context& context) {
+    JobScope scope(context);
 
+    // Execute job function.
+    try {
+        if (job.args_handler != nullptr) {
+            job.args_handler(gaia::arguments(reference_arguments(request)));
+        } else {
             // Transform arguments.
             list<gaia::argument> args;
-            for (int i = 0; i < (*request).args_size(); ++i) {
+            for (auto const& ref : reference_arguments(request)) {
                 gaia::argument arg = {};
-                arg.key = (*request).args(i).key();
-                arg.value = (*request).args(i).value();
+                arg.key.assign(ref.key.data(), ref.key.size());
+                arg.value.assign(ref.value.data(), ref.value.size());
                 args.push_back(arg);
             }
+            job.handler(std::move(args));
+        }
+    } catch (string e) {
+        set_job_error(job, e, response);
+    }
+}
+
+#ifdef GAIA_COROUTINES
+// start_task starts a coroutine job. done is called from the executor
+// thread which finishes the coroutine.
+template <typename Request>
+static void start_task(const gaia::job_wrapper& job, const Request& request, JobResult* response,
+        const job_context& context, std::function<void(Status)> done) {
+    // The arguments must outlive every suspension of the coroutine.
+    struct execution {
+        explicit execution(const Request& request) : args(reference_arguments(request)) {}
 
-            // Execute job function.
+        gaia::arguments args;
+        gaia::task task;
+    };
+    std::shared_ptr<execution> state = std::make_shared<execution>(request);
+    state->task = job.task_handler(state->args);
+
+    // Awaitables pick the context up when the coroutine suspends and make
+    // it current again when they resume it.
+    JobScope scope(context);
+
+    const gaia::job_wrapper* job_p = &job;
+    state->task.Start([state, job_p, response, done](std::exception_ptr error) mutable {
+        Status status = Status::OK;
+        if (error) {
             try {
-                (*job).handler(args);
+                std::rethrow_exception(error);
             } catch (string e) {
-                // Check if job wants to force exit pipeline.
-                // We will exit the pipeline but not mark as 'failed'.
-                if (e.compare(ERR_EXIT_PIPELINE) != 0) {
-                   response->set_failed(true);
+                set_job_error((*job_p), e, response);
+            } catch (...) {
+                status = Status(grpc::StatusCode::UNKNOWN, ERR_UNEXPECTED);
+            }
+        }
+
+        // Destroys the coroutine, so it must be the last reference.
+        state.reset();
+        done(status);
+    });
+}
+#endif
+
+// GetJobs streams the jobs serialized once at startup, so it is always
+// served as raw method from a completion queue.
+typedef Plugin::WithRawMethod_GetJobs<Plugin::Service> RawJobsService;
+
+class GRPCPluginImpl final : public RawJobsService {
+    public:
+        Status ExecuteJob(ServerContext* context, const Job* request, JobResult* response) {
+            return ExecuteAndWait(context, request, response);
+        }
+
+        Status Execute(ServerContext* context, const ExecuteRequest* request, JobResult* response) {
+            return ExecuteAndWait(context, request, response);
+        }
+
+        Status ExecuteJobStream(ServerContext* context, const Job* request, ServerWriter<JobOutput>* writer) {
+            // The handler writes its log into the buffer from the executor.
+            // This thread forwards it in chunks and applies backpressure:
+            // while gRPC flow control blocks the writer the buffer fills up
+            // and the handler blocks in WriteLog.
+            job_context job;
+            job.log = std::make_shared<LogBuffer>(log_buffer_size);
+            std::shared_ptr<LogBuffer> log = job.log;
+            const gaia::cancellation_token& token = job.token;
+            JobOutput result;
+            std::promise<Status> done;
+            StartJob(request, result.mutable_result(), job, [&done, log](Status status) {
+                log->CloseWrite();
+                done.set_value(status);
+            });
+
+            JobOutput output;
+            string* chunk = output.mutable_log();
+            while (!log->Drained()) {
+                chunk->resize(LOG_CHUNK_SIZE);
+                size_t size = log->Read(&(*chunk)[0], chunk->size(), CANCEL_POLL_INTERVAL);
+                if (size > 0) {
+                    chunk->resize(size);
+                    if (!writer->Write(output)) {
+                        // Gaia is gone, drop the rest of the log.
+                        log->Close();
+                        token.Cancel();
+                        break;
+                    }
+                }
+                if (!token.IsCancelled() && (context->IsCancelled() || std::chrono::system_clock::now() > context->deadline())) {
+                    log->Close();
+                    token.Cancel();
+                    break;
+                }
+            }
+
+            // The job must have finished before request and result go away.
+            Status status = done.get_future().get();
+            if (token.IsCancelled()) {
+                return Status(grpc::StatusCode::CANCELLED, ERR_JOB_CANCELLED);
+            } else if (!status.ok()) {
+                return status;
+            }
+            writer->Write(result);
+            return Status::OK;
+        }
+
+        Status ExecuteJobs(ServerContext* context, const JobBatch* request, ServerWriter<JobResult>* writer) {
+            // Resolve the jobs and their dependencies within the batch.
+            // Dependencies outside of the batch have been run by Gaia before.
+            size_t count = request->jobs_size();
+            std::unordered_map<uint64_t, size_t> positions;
+            std::vector<const gaia::job_wrapper*> jobs(count);
+            for (size_t i = 0; i < count; ++i) {
+                jobs[i] = FindJob(request->jobs(i));
+                if (jobs[i] == nullptr) {
+                    return Status(grpc::StatusCode::CANCELLED, ERR_JOB_NOT_FOUND);
+                } else if (!positions.emplace(jobs[i]->job.unique_id64(), i).second) {
+                    return Status(grpc::StatusCode::INVALID_ARGUMENT, ERR_DUPLICATE_BATCH_JOB);
+                }
+            }
+            std::vector<std::vector<size_t>> dependencies(count);
+            std::vector<double> costs(count);
+            for (size_t i = 0; i < count; ++i) {
+                costs[i] = history->Estimate(jobs[i]->job.unique_id64());
+                for (uint64_t id : jobs[i]->job.dependson64()) {
+                    auto found = positions.find(id);
+                    if (found != positions.end()) {
+                        dependencies[i].push_back(found->second);
+                    }
+                }
+            }
+
+            // The jobs run on the executor and report back to this thread.
+            // It writes their results and starts the jobs which got ready.
+            struct completion {
+                size_t index;
+                Status status;
+            };
+            std::mutex mutex;
+            std::condition_variable cv;
+            std::deque<completion> completions;
+            std::vector<JobResult> results(count);
+            job_context job;
+            const gaia::cancellation_token& token = job.token;
+            // The batch gets at most one job per executor thread at a time,
+            // so the executor starts them in the order of the scheduler.
+            JobScheduler scheduler(dependencies, costs);
+            size_t limit = executor->Stats().threads;
+            std::vector<size_t> ready;
+            std::vector<bool> reported(count, false);
+            for (;;) {
+                scheduler.Next(ready, limit);
+                for (size_t index : ready) {
+                    results[index].set_unique_id(jobs[index]->job.unique_id());
+                    results[index].set_unique_id64(jobs[index]->job.unique_id64());
+                    StartJob(&request->jobs(index), &results[index], job, [&mutex, &cv, &completions, index](Status status) {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        completions.push_back(completion{index, status});
+                        cv.notify_one();
+                    });
+                }
+                if (scheduler.Done()) {
+                    break;
+                }
+
+                completion finished;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    if (!cv.wait_for(lock, CANCEL_POLL_INTERVAL, [&completions]() { return !completions.empty(); })) {
+                        lock.unlock();
+                        if (!token.IsCancelled() && (context->IsCancelled() || std::chrono::system_clock::now() > context->deadline())) {
+                            token.Cancel();
+                            scheduler.Stop();
+                        }
+                        continue;
+                    }
+                    finished = completions.front();
+                    completions.pop_front();
+                }
+
+                // A job which has been rejected, e.g. by a full admission
+                // queue, fails on its own instead of the whole call.
+                JobResult& result = results[finished.index];
+                if (!finished.status.ok()) {
+                    result.set_failed(true);
+                    result.set_message(finished.status.error_message());
+                }
+                scheduler.Finished(finished.index, !result.failed() && !result.exit_pipeline());
+                reported[finished.index] = true;
+                if (!token.IsCancelled() && !writer->Write(result)) {
+                    // Gaia is gone, stop the remaining jobs.
+                    token.Cancel();
+                    scheduler.Stop();
                 }
+            }
 
-                // Set log message and job id.
-                response->set_exit_pipeline(true);
-                response->set_message(e);
-                response->set_unique_id((*job).job.unique_id());
+            if (token.IsCancelled()) {
+                return Status(grpc::StatusCode::CANCELLED, ERR_JOB_CANCELLED);
             }
 
+            // Every job gets a result. Those which did not run after a
+            // failure are reported as skipped.
+            for (size_t i = 0; i < count; ++i) {
+                if (reported[i]) {
+                    continue;
+                }
+                JobResult skipped;
+                skipped.set_unique_id(jobs[i]->job.unique_id());
+                skipped.set_unique_id64(jobs[i]->job.unique_id64());
+                skipped.set_failed(true);
+                skipped.set_message(ERR_JOB_SKIPPED);
+                if (!writer->Write(skipped)) {
+                    break;
+                }
+            }
             return Status::OK;
         }
 
-        void PushCachedJobs(gaia::job_wrapper* job) {
-            cached_jobs.push_back(*job);
+        Status Session(ServerContext* context, ServerReaderWriter<SessionResult, SessionRequest>* stream) {
+            // A reader thread starts the executions Gaia sends. They run on
+            // the executor and report back to this thread, which writes
+            // their results. Every execution has its own token, so Gaia can
+            // cancel it alone.
+            struct execution {
+                ExecuteRequest request;
+                JobResult result;
+                job_context job;
+            };
+            struct completion {
+                uint64_t correlation_id;
+                Status status;
+                unique_ptr<execution> finished;
+            };
+            std::mutex mutex;
+            std::condition_variable cv;
+            std::deque<completion> completions;
+            std::unordered_map<uint64_t, unique_ptr<execution>> executions;
+            bool reading = true;
+            bool cancelled = false;
+
+            // cancel_all fires the tokens of all running executions. Called
+            // with the lock held, the tokens fire outside of it since their
+            // callbacks may complete executions.
+            auto cancel_all = [&executions, &cancelled](std::unique_lock<std::mutex>& lock) {
+                cancelled = true;
+                std::vector<gaia::cancellation_token> tokens;
+                for (auto const& running : executions) {
+                    tokens.push_back(running.second->job.token);
+                }
+                lock.unlock();
+                for (auto const& token : tokens) {
+                    token.Cancel();
+                }
+                lock.lock();
+            };
+
+            std::thread reader([this, stream, &mutex, &cv, &completions, &executions, &reading, &cancelled]() {
+                SessionRequest message;
+                while (stream->Read(&message)) {
+                    uint64_t correlation_id = message.correlation_id();
+                    std::unique_lock<std::mutex> lock(mutex);
+                    auto found = executions.find(correlation_id);
+                    if (message.cancel()) {
+                        if (found != executions.end()) {
+                            gaia::cancellation_token token = found->second->job.token;
+                            lock.unlock();
+                            token.Cancel();
+                        }
+                        continue;
+                    }
+                    if (cancelled || found != executions.end()) {
+                        Status status = cancelled ? Status(grpc::StatusCode::CANCELLED, ERR_JOB_CANCELLED)
+                                                  : Status(grpc::StatusCode::INVALID_ARGUMENT, ERR_DUPLICATE_CORRELATION_ID);
+                        completions.push_back(completion{correlation_id, status, nullptr});
+                        cv.notify_one();
+                        continue;
+                    }
+                    execution* started = new execution();
+                    started->request.Swap(message.mutable_execute());
+                    executions.emplace(correlation_id, unique_ptr<execution>(started));
+                    lock.unlock();
+
+                    StartJob(&started->request, &started->result, started->job, [&mutex, &cv, &completions, &executions, correlation_id](Status status) {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        auto done = executions.find(correlation_id);
+                        completions.push_back(completion{correlation_id, status, std::move(done->second)});
+                        executions.erase(done);
+                        cv.notify_one();
+                    });
+                }
+                std::lock_guard<std::mutex> lock(mutex);
+                reading = false;
+                cv.notify_one();
+            });
+
+            // Results are written until Gaia has closed its side and every
+            // execution has finished, which must have happened before the
+            // executions go away.
+            SessionResult reply;
+            std::unique_lock<std::mutex> lock(mutex);
+            while (reading || !executions.empty() || !completions.empty()) {
+                if (!cv.wait_for(lock, CANCEL_POLL_INTERVAL, [&]() { return !completions.empty() || (!reading && executions.empty()); })) {
+                    if (!cancelled && (context->IsCancelled() || std::chrono::system_clock::now() > context->deadline())) {
+                        cancel_all(lock);
+                    }
+                    continue;
+                }
+                if (completions.empty()) {
+                    continue;
+                }
+                completion next = std::move(completions.front());
+                completions.pop_front();
+                bool write = !cancelled;
+                lock.unlock();
+
+                reply.Clear();
+                reply.set_correlation_id(next.correlation_id);
+                Status status = next.status;
+                if (next.finished != nullptr && next.finished->job.token.IsCancelled()) {
+                    status = Status(grpc::StatusCode::CANCELLED, ERR_JOB_CANCELLED);
+                }
+                if (status.ok()) {
+                    reply.mutable_result()->Swap(&next.finished->result);
+                } else {
+                    reply.set_status_code(status.error_code());
+                    reply.set_status_message(status.error_message());
+                }
+                bool written = !write || stream->Write(reply);
+
+                lock.lock();
+                if (!written && !cancelled) {
+                    // Gaia is gone, stop the running jobs.
+                    cancel_all(lock);
+                }
+            }
+            lock.unlock();
+            reader.join();
+
+            if (cancelled) {
+                return Status(grpc::StatusCode::CANCELLED, ERR_JOB_CANCELLED);
+            }
+            return Status::OK;
+        }
+
+        // StartJob looks up the requested job and hands it to the executor
+        // once it holds the semaphores of its concurrency policy and
+        // admission control lets it run. done is called with the rpc
+        // status once the job has finished. request and response must stay
+        // valid until then.
+        template <typename Request>
+        void StartJob(const Request* request, JobResult* response, const job_context& context, std::function<void(Status)> done) {
+            const gaia::job_wrapper * job = FindJob(*request);
+            if (job == nullptr) {
+                done(Status(grpc::StatusCode::CANCELLED, ERR_JOB_NOT_FOUND));
+                return;
+            }
+            size_t index = job - &registry->Jobs()[0];
+            std::atomic<long>* job_pending = &pending[index];
+            ++(*job_pending);
+            done = [done, job_pending](Status status) {
+                --(*job_pending);
+                done(status);
+            };
+
+            // release_slots returns the semaphores of the policy, if any.
+            JobSemaphores* job_semaphores = semaphores->Needed(index) ? semaphores : nullptr;
+            std::function<void()> release_slots = [job_semaphores, index]() {
+                if (job_semaphores != nullptr) {
+                    job_semaphores->Release(index);
+                }
+            };
+
+            JobExecutor* job_executor = executor;
+            JobHistory* job_history = history;
+            AdmissionControl* job_admission = admission;
+            ConcurrencyLimiter* job_limiter = limiter;
+            std::function<void()> start = [job, request, response, context, done, job_executor, job_history, job_admission, job_limiter, release_slots]() {
+                // The limiter sees the time from admission on, so jobs
+                // queueing up in the executor count as slow.
+                std::chrono::steady_clock::time_point admitted = std::chrono::steady_clock::now();
+                job_executor->Submit([job, request, response, context, done, job_history, job_admission, job_limiter, release_slots, admitted]() {
+                    // The wall clock time of every execution goes into the history.
+                    uint64_t id = (*job).job.unique_id64();
+                    std::chrono::steady_clock::time_point started = std::chrono::steady_clock::now();
+                    std::function<void(Status)> finish = [done, job_history, job_admission, job_limiter, release_slots, id, admitted, started](Status status) {
+                        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+                        if (status.ok() && job_limiter != nullptr) {
+                            job_limiter->Record(id, std::chrono::duration_cast<std::chrono::microseconds>(now - admitted).count());
+                        }
+                        job_admission->Release();
+                        release_slots();
+                        done(status);
+                        if (status.ok()) {
+                            job_history->Record(id, std::chrono::duration_cast<std::chrono::microseconds>(now - started));
+                        }
+                    };
+#ifdef GAIA_COROUTINES
+                    if ((*job).task_handler != nullptr) {
+                        start_task((*job), (*request), response, context, finish);
+                        return;
+                    }
+#endif
+                    Status status = Status::OK;
+                    try {
+                        run_job((*job), (*request), response, context);
+                    } catch (...) {
+                        status = Status(grpc::StatusCode::UNKNOWN, ERR_UNEXPECTED);
+                    }
+                    finish(status);
+                });
+            };
+
+            // Jobs waiting for their semaphores do not take an admission
+            // slot, so they never block unrelated jobs.
+            gaia::cancellation_token token = context.token;
+            std::function<void()> admit = [job_admission, token, start, release_slots, done]() {
+                std::function<void()> cancelled = [release_slots, done]() {
+                    release_slots();
+                    done(Status(grpc::StatusCode::CANCELLED, ERR_JOB_CANCELLED));
+                };
+                if (!job_admission->Admit(token, start, cancelled)) {
+                    release_slots();
+                    done(Status(grpc::StatusCode::RESOURCE_EXHAUSTED, ERR_ADMISSION_QUEUE_FULL));
+                }
+            };
+            if (job_semaphores == nullptr) {
+                admit();
+                return;
+            }
+            job_semaphores->Acquire(index, token, admit, [done]() {
+                done(Status(grpc::StatusCode::CANCELLED, ERR_JOB_CANCELLED));
+            });
+        }
+
+        // FindJob returns the requested job or nullptr. Gaia sends the 64
+        // bit id from protocol version 4 on, the 32 bit one before.
+        template <typename Request>
+        const gaia::job_wrapper* FindJob(const Request& request) const {
+            if (request.unique_id64() != 0) {
+                return registry->Find64(request.unique_id64());
+            }
+            return registry->Find(request.unique_id());
+        }
+
+        const JobRegistry& Registry() const {
+            return (*registry);
+        }
+
+        void SetRegistry(const JobRegistry* job_registry) {
+            registry = job_registry;
+            pending.reset(new std::atomic<long>[registry->Jobs().size()]());
+        }
+
+        // Pending returns the number of started and waiting executions of
+        // the job at the given registry position.
+        long Pending(size_t index) const {
+            return pending[index].load();
+        }
+
+        void SetExecutor(JobExecutor* job_executor) {
+            executor = job_executor;
+        }
+
+        void SetLogBufferSize(size_t size) {
+            log_buffer_size = size;
+        }
+
+        void SetHistory(JobHistory* job_history) {
+            history = job_history;
         }
 
-        static bool compare(gaia::job_wrapper a, gaia::job_wrapper b) {
-            return (a.job.unique_id() == b.job.unique_id());
+        void SetAdmission(AdmissionControl* admission_control) {
+            admission = admission_control;
         }
 
-        void ApplyUnique() throw(string) {
-            int before_unique = cached_jobs.size();
-            cached_jobs.unique(compare);
-            if (before_unique > cached_jobs.size()) {
-                throw ERR_DUPLICATE_JOB;
+        void SetSemaphores(JobSemaphores* job_semaphores) {
+            semaphores = job_semaphores;
+        }
+
+        // SetLimiter enables the adaptive concurrency limit. Without it
+        // admission control keeps its fixed limit.
+        void SetLimiter(ConcurrencyLimiter* concurrency_limiter) {
+            limiter = concurrency_limiter;
+        }
+
+    private:
+        // ExecuteAndWait serves a unary execution.
+        template <typename Request>
+        Status ExecuteAndWait(ServerContext* context, const Request* request, JobResult* response) {
+            // The transport thread only waits, the handler runs on the executor.
+            // While waiting it watches the call and fires the token if Gaia
+            // cancels it or the deadline expires.
+            job_context job;
+            const gaia::cancellation_token& token = job.token;
+            std::promise<Status> result;
+            StartJob(request, response, job, [&result](Status status) {
+                result.set_value(status);
+            });
+            std::future<Status> status = result.get_future();
+            while (status.wait_for(CANCEL_POLL_INTERVAL) != std::future_status::ready) {
+                if (!token.IsCancelled() && (context->IsCancelled() || std::chrono::system_clock::now() > context->deadline())) {
+                    token.Cancel();
+                }
             }
+            if (token.IsCancelled()) {
+                return Status(grpc::StatusCode::CANCELLED, ERR_JOB_CANCELLED);
+            }
+            return status.get();
+        }
+
+        const JobRegistry* registry;
+        JobExecutor* executor;
+        size_t log_buffer_size;
+        JobHistory* history;
+        AdmissionControl* admission;
+        JobSemaphores* semaphores;
+        ConcurrencyLimiter* limiter = nullptr;
+        unique_ptr<std::atomic<long>[]> pending;
+};
+
+// AsyncPluginService additionally serves ExecuteJob and Execute from
+// completion queues. Both are raw, their requests are decoded partially
+// by JobRequest. ExecuteJobStream, ExecuteJobs and Session stay
+// synchronous, their transport thread drives the execution, and are
+// passed on to the plugin service.
+class AsyncPluginService final : public Plugin::WithRawMethod_ExecuteJob<Plugin::WithRawMethod_Execute<RawJobsService>> {
+    public:
+        explicit AsyncPluginService(GRPCPluginImpl* service) : service(service) {}
+
+        Status ExecuteJobStream(ServerContext* context, const Job* request, ServerWriter<JobOutput>* writer) {
+            return service->ExecuteJobStream(context, request, writer);
+        }
+
+        Status ExecuteJobs(ServerContext* context, const JobBatch* request, ServerWriter<JobResult>* writer) {
+            return service->ExecuteJobs(context, request, writer);
+        }
+
+        Status Session(ServerContext* context, ServerReaderWriter<SessionResult, SessionRequest>* stream) {
+            return service->Session(context, stream);
         }
 
     private:
-        list<gaia::job_wrapper> cached_jobs;
-        
-        // GetJob finds the right job in the cache and returns it.
-        gaia::job_wrapper * GetJob(const Job job) {
-            for (auto & cached_job : cached_jobs) {
-                if (cached_job.job.unique_id() == job.unique_id()) {
-                    return &cached_job;
+        GRPCPluginImpl* service;
+};
+
+// AsyncCall is a single in-flight rpc served from a completion queue.
+// The call object itself is used as completion queue tag.
+class AsyncCall {
+    public:
+        virtual ~AsyncCall() {}
+
+        // Proceed advances the call after the completion queue returned
+        // its tag. ok is false if the operation failed or the server is
+        // shutting down.
+        virtual void Proceed(bool ok) = 0;
+};
+
+// AsyncExecuteCall serves a unary execution, ExecuteJob or Execute
+// depending on the given request method.
+class AsyncExecuteCall final : public AsyncCall {
+    public:
+        typedef void (AsyncPluginService::*RequestMethod)(ServerContext*, grpc::ByteBuffer*,
+            ServerAsyncResponseWriter<grpc::ByteBuffer>*, grpc::CompletionQueue*, ServerCompletionQueue*, void*);
+
+        AsyncExecuteCall(AsyncPluginService* async_service, RequestMethod method, GRPCPluginImpl* service,
+                         ServerCompletionQueue* cq)
+            : async_service(async_service), method(method), service(service), cq(cq), slot(ArenaPool::Acquire()),
+              response(google::protobuf::Arena::CreateMessage<JobResult>(&slot->arena)),
+              responder(&context), done_tag(this), started(false), references(2) {
+            context.AsyncNotifyWhenDone(&done_tag);
+            (async_service->*method)(&context, &request_buffer, &responder, cq, cq, this);
+        }
+
+        ~AsyncExecuteCall() {
+            ArenaPool::Release(slot);
+        }
+
+        void Proceed(bool ok) {
+            if (!started) {
+                // The done tag is only delivered for calls which started.
+                if (!ok) {
+                    delete this;
+                    return;
                 }
+                started = true;
+
+                // Accept the next call before we run this one.
+                new AsyncExecuteCall(async_service, method, service, cq);
+                if (!request.Parse(&request_buffer)) {
+                    responder.FinishWithError(Status(grpc::StatusCode::INTERNAL, ERR_INVALID_REQUEST), this);
+                    return;
+                }
+
+                // The poller returns immediately, the executor finishes the call.
+                service->StartJob(&request, response, job, [this](Status status) {
+                    if (!status.ok()) {
+                        responder.FinishWithError(status, this);
+                        return;
+                    }
+                    bool own_buffer;
+                    grpc::SerializationTraits<JobResult>::Serialize(*response, &response_buffer, &own_buffer);
+                    responder.Finish(response_buffer, status, this);
+                });
+                return;
+            }
+
+            // The response has been sent.
+            Release();
+        }
+
+    private:
+        // DoneTag is returned by the completion queue once the call is
+        // done, either finished or cancelled.
+        class DoneTag final : public AsyncCall {
+            public:
+                explicit DoneTag(AsyncExecuteCall* call) : call(call) {}
+
+                void Proceed(bool) {
+                    if (call->context.IsCancelled()) {
+                        call->job.token.Cancel();
+                    }
+                    call->Release();
+                }
+
+            private:
+                AsyncExecuteCall* call;
+        };
+
+        AsyncPluginService* async_service;
+        RequestMethod method;
+        GRPCPluginImpl* service;
+        ServerCompletionQueue* cq;
+        ArenaPool::Slot* slot;
+        grpc::ByteBuffer request_buffer;
+        JobRequest request;
+        JobResult* response;
+        grpc::ByteBuffer response_buffer;
+        ServerContext context;
+        ServerAsyncResponseWriter<grpc::ByteBuffer> responder;
+        job_context job;
+        DoneTag done_tag;
+        bool started;
+        std::atomic<int> references;
+
+        // Release deletes the call once both the finish and the done tag
+        // have been returned. They may arrive on different pollers.
+        void Release() {
+            if (--references == 0) {
+                delete this;
             }
-            return nullptr;
         }
 };
 
-static unsigned int fnvHash(const char* str) {
-    const size_t length = strlen(str) + 1;
-    unsigned int hash = OFFSET_BASIS;
-    for (size_t i = 0; i < length; ++i) {
-        hash ^= *str++;
-        hash *= FNV_PRIME;
-    }
-    return hash;
+class AsyncGetJobsCall final : public AsyncCall {
+    public:
+        AsyncGetJobsCall(RawJobsService* raw_service, const JobRegistry* registry, ServerCompletionQueue* cq)
+            : raw_service(raw_service), registry(registry), cq(cq), writer(&context), started(false), finished(false), next(0) {
+            raw_service->RequestGetJobs(&context, &request, &writer, cq, cq, this);
+        }
+
+        void Proceed(bool ok) {
+            if (!ok || finished) {
+                delete this;
+                return;
+            }
+
+            if (!started) {
+                // Accept the next call before we stream the jobs.
+                new AsyncGetJobsCall(raw_service, registry, cq);
+                started = true;
+
+                // The etag goes out with the initial metadata. A client
+                // which sends the current one already has all jobs.
+                context.AddInitialMetadata(JOBS_ETAG_METADATA, registry->Etag());
+                auto sent = context.client_metadata().find(JOBS_ETAG_METADATA);
+                if (sent != context.client_metadata().end() && sent->second == registry->Etag()) {
+                    finished = true;
+                    writer.Finish(Status::OK, this);
+                    return;
+                }
+            }
+
+            // Send one job per completion and finish after the last one.
+            const std::vector<grpc::ByteBuffer>& jobs = registry->Serialized();
+            if (next == jobs.size()) {
+                finished = true;
+                writer.Finish(Status::OK, this);
+                return;
+            }
+            writer.Write(jobs[next], this);
+            ++next;
+        }
+
+    private:
+        RawJobsService* raw_service;
+        const JobRegistry* registry;
+        ServerCompletionQueue* cq;
+        ServerContext context;
+        grpc::ByteBuffer request;
+        ServerAsyncWriter<grpc::ByteBuffer> writer;
+        bool started;
+        bool finished;
+        size_t next;
+};
+
+// AsyncPluginServer serves the plugin rpcs from completion queues.
+// Every queue is drained by its own poller threads, so in-flight calls
+// do not pin a thread of the synchronous server pool.
+// Without async_execute only GetJobs is served from the queues and
+// ExecuteJob is left to the synchronous service.
+class AsyncPluginServer {
+    public:
+        AsyncPluginServer(GRPCPluginImpl* service, int cq_count, int pollers, bool async_execute)
+            : service(service), async_service(service), cq_count(cq_count), pollers(pollers), async_execute(async_execute) {}
+
+        // Register adds the service and completion queues to the builder.
+        void Register(ServerBuilder& builder) {
+            if (async_execute) {
+                builder.RegisterService(&async_service);
+            } else {
+                builder.RegisterService(service);
+            }
+            for (int i = 0; i < cq_count; ++i) {
+                cqs.push_back(builder.AddCompletionQueue());
+            }
+        }
+
+        // Start must be called after the server has been started.
+        void Start() {
+            for (size_t q = 0; q < cqs.size(); ++q) {
+                ServerCompletionQueue* cq = cqs[q].get();
+                for (int i = 0; i < pollers; ++i) {
+                    if (async_execute) {
+                        new AsyncExecuteCall(&async_service, &AsyncPluginService::RequestExecuteJob, service, cq);
+                        new AsyncExecuteCall(&async_service, &AsyncPluginService::RequestExecute, service, cq);
+                        new AsyncGetJobsCall(&async_service, &service->Registry(), cq);
+                    } else {
+                        new AsyncGetJobsCall(service, &service->Registry(), cq);
+                    }
+                    threads.push_back(std::thread(&AsyncPluginServer::Poll, cq));
+                }
+            }
+        }
+
+        // Shutdown must be called after the server has been shut down.
+        void Shutdown() {
+            for (auto const& cq : cqs) {
+                cq->Shutdown();
+            }
+            for (auto & thread : threads) {
+                thread.join();
+            }
+        }
+
+    private:
+        GRPCPluginImpl* service;
+        AsyncPluginService async_service;
+        int cq_count;
+        int pollers;
+        bool async_execute;
+        std::vector<unique_ptr<ServerCompletionQueue>> cqs;
+        std::vector<std::thread> threads;
+
+        static void Poll(ServerCompletionQueue* cq) {
+            void* tag;
+            bool ok;
+            while (cq->Next(&tag, &ok)) {
+                static_cast<AsyncCall*>(tag)->Proceed(ok);
+            }
+        }
 };
 
 static bool read_file(const string& filename, string& data) {
@@ -139,15 +1015,570 @@ static bool read_file(const string& filename, string& data) {
 	return false;
 }
 
+// fold_title transforms the title to lower case for higher matching.
+static string fold_title(const string& title) {
+    string folded(title);
+    std::transform(folded.begin(), folded.end(), folded.begin(), ::tolower);
+    return folded;
+}
+
+// validate_jobs checks the job graph of the pipeline in a single pass.
+// It returns the indexes of the dependencies of every job. Duplicate
+// titles, undeclared dependencies and dependency cycles are all reported
+// together in the thrown error.
+static std::vector<std::vector<size_t>> validate_jobs(const std::vector<const gaia::job*>& jobs) GAIA_THROWS {
+    std::vector<string> errors;
+
+    // Index all case folded titles once.
+    std::unordered_map<string, size_t> titles;
+    titles.reserve(jobs.size());
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        auto inserted = titles.emplace(fold_title(jobs[i]->title), i);
+        if (!inserted.second) {
+            errors.push_back(ERR_DUPLICATE_JOB + ": '" + jobs[inserted.first->second]->title +
+                "' and '" + jobs[i]->title + "'");
+        }
+    }
+
+    // Resolve dependencies.
+    std::vector<std::vector<size_t>> dependencies(jobs.size());
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        for (auto const& dependency : jobs[i]->depends_on) {
+            auto found = titles.find(fold_title(dependency));
+            if (found == titles.end()) {
+                errors.push_back("job '" + jobs[i]->title + "' has dependency '" + dependency + "' which is not declared");
+                continue;
+            }
+            dependencies[i].push_back(found->second);
+        }
+    }
+
+    // Detect cycles with an iterative depth first search. Every edge back
+    // into the current path closes a cycle.
+    const char unvisited = 0, on_path = 1, done = 2;
+    std::vector<char> state(jobs.size(), unvisited);
+    std::vector<size_t> path_position(jobs.size());
+    std::vector<std::pair<size_t, size_t>> path;
+    for (size_t root = 0; root < jobs.size(); ++root) {
+        if (state[root] != unvisited) {
+            continue;
+        }
+        state[root] = on_path;
+        path_position[root] = 0;
+        path.push_back(std::make_pair(root, 0));
+        while (!path.empty()) {
+            size_t current = path.back().first;
+            size_t next_edge = path.back().second;
+            if (next_edge == dependencies[current].size()) {
+                state[current] = done;
+                path.pop_back();
+                continue;
+            }
+            path.back().second++;
+
+            size_t dependency = dependencies[current][next_edge];
+            if (state[dependency] == unvisited) {
+                state[dependency] = on_path;
+                path_position[dependency] = path.size();
+                path.push_back(std::make_pair(dependency, 0));
+            } else if (state[dependency] == on_path) {
+                string cycle;
+                for (size_t i = path_position[dependency]; i < path.size(); ++i) {
+                    cycle += "'" + jobs[path[i].first]->title + "' -> ";
+                }
+                errors.push_back("dependency cycle detected: " + cycle + "'" + jobs[dependency]->title + "'");
+            }
+        }
+    }
+
+    if (!errors.empty()) {
+        string message = errors.front();
+        for (size_t i = 1; i < errors.size(); ++i) {
+            message += "\n" + errors[i];
+        }
+        throw message;
+    }
+    return dependencies;
+}
+
+// make_socket_dir creates a directory for the unix socket which only the
+// plugin user can access. It is created in the directory go-plugin
+// provides, the temp directory otherwise.
+static string make_socket_dir() GAIA_THROWS {
+    const char* base = std::getenv(UNIX_SOCKET_DIR_ENV.c_str());
+    if (base == nullptr) {
+        base = std::getenv("TMPDIR");
+    }
+    if (base == nullptr) {
+        base = "/tmp";
+    }
+    string pattern = string(base) + "/gaia-plugin-XXXXXX";
+    std::vector<char> path(pattern.begin(), pattern.end());
+    path.push_back('\0');
+    if (mkdtemp(path.data()) == nullptr) {
+        throw "cannot create socket directory in " + string(base);
+    }
+    return string(path.data());
+}
+
+// The socket and its directory, kept for the signal handler which
+// removes them when the plugin is terminated.
+static char socket_dir_path[PATH_MAX];
+static char socket_file_path[PATH_MAX];
+
+static void remove_socket_on_signal(int signal) {
+    unlink(socket_file_path);
+    rmdir(socket_dir_path);
+    std::signal(signal, SIG_DFL);
+    std::raise(signal);
+}
+
+// watch_socket_dir removes the socket directory if the plugin is killed
+// with SIGTERM or SIGINT. Handlers installed by the pipeline are kept.
+static void watch_socket_dir(const string& dir, const string& socket_path) {
+    if (dir.size() >= PATH_MAX || socket_path.size() >= PATH_MAX) {
+        return;
+    }
+    std::copy(dir.begin(), dir.end(), socket_dir_path);
+    std::copy(socket_path.begin(), socket_path.end(), socket_file_path);
+    for (int signal : { SIGTERM, SIGINT }) {
+        struct sigaction current;
+        if (sigaction(signal, nullptr, &current) == 0 && current.sa_handler == SIG_DFL) {
+            std::signal(signal, remove_socket_on_signal);
+        }
+    }
+}
+
+// remove_socket_dir removes the socket and its directory, if any.
+static void remove_socket_dir(const string& dir, const string& socket_path) {
+    if (dir.empty()) {
+        return;
+    }
+    unlink(socket_path.c_str());
+    rmdir(dir.c_str());
+}
+
+// read_env_string returns the value of the given env variable or the
+// fallback if it is not set.
+static string read_env_string(const string& name, const string& fallback) {
+    char* value_p = std::getenv(name.c_str());
+    return value_p == nullptr ? fallback : string(value_p);
+}
+
+// negotiate_protocol_version returns the highest protocol version which
+// both the plugin and Gaia speak. go-plugin lists the versions of Gaia in
+// the given env variable, e.g. "2,3".
+static int negotiate_protocol_version(const string& name) {
+    std::istringstream value(read_env_string(name, ""));
+    string entry;
+    int version = PROTOCOL_VERSION;
+    while (std::getline(value, entry, ',')) {
+        int offered = std::atoi(entry.c_str());
+        if (offered > version && offered <= LATEST_PROTOCOL_VERSION) {
+            version = offered;
+        }
+    }
+    return version;
+}
+
+// wide_job_ids returns true if Gaia addresses jobs by their 64 bit ids.
+static bool wide_job_ids() {
+    return negotiate_protocol_version(PROTOCOL_VERSIONS_ENV) >= WIDE_ID_PROTOCOL_VERSION;
+}
+
+// read_env_resources adds the resource slots of the given env variable,
+// e.g. "docker=2,db=1", which are not set in resources yet.
+static void read_env_resources(const string& name, std::map<string, int>& resources) GAIA_THROWS {
+    std::istringstream value(read_env_string(name, ""));
+    string entry;
+    while (std::getline(value, entry, ',')) {
+        if (entry.empty()) {
+            continue;
+        }
+        size_t separator = entry.find('=');
+        char* end = nullptr;
+        long slots = separator == string::npos ? 0 : std::strtol(entry.c_str() + separator + 1, &end, 10);
+        if (separator == 0 || slots < 1 || slots > INT_MAX || *end != '\0') {
+            throw "invalid resource in " + name + ": " + entry;
+        }
+        resources.emplace(entry.substr(0, separator), (int)slots);
+    }
+}
+
+// resolve_options fills all unset options from the env variables and
+// the defaults.
+static gaia::serve_options resolve_options(gaia::serve_options options) GAIA_THROWS {
+    // Size after the cgroup limits of the container the plugin runs in.
+    // A fraction of a core is rounded down, since threads beyond the cpu
+    // quota only get throttled.
+    int cores = std::thread::hardware_concurrency();
+    if (cores < 1) {
+        cores = 1;
+    }
+    container_limits limits = ReadContainerLimits();
+    if (limits.cpus > 0) {
+        cores = std::max(1, std::min(cores, (int)limits.cpus));
+    }
+    if (options.server_mode.empty()) {
+        options.server_mode = read_env_string(SERVER_MODE_ENV, "");
+    }
+    if (options.network.empty()) {
+        options.network = read_env_string(NETWORK_ENV, PROTOCOL_NETWORK);
+    }
+    if (options.job_history.empty()) {
+        options.job_history = read_env_string(JOB_HISTORY_ENV, "");
+    }
+
+    // By default the executor gets one thread per core so that running
+    // handlers saturate but not oversubscribe the host. The async mode
+    // uses one completion queue per core.
+    if (options.executor_threads <= 0) {
+        options.executor_threads = ReadEnvInt(EXECUTOR_THREADS_ENV, cores);
+    }
+    if (options.async_cq_count <= 0) {
+        options.async_cq_count = ReadEnvInt(CQ_COUNT_ENV, cores);
+    }
+    if (options.async_pollers <= 0) {
+        options.async_pollers = ReadEnvInt(CQ_POLLERS_ENV, 1);
+    }
+    if (options.log_buffer_size <= 0) {
+        options.log_buffer_size = ReadEnvInt(LOG_BUFFER_SIZE_ENV, DEFAULT_LOG_BUFFER_SIZE);
+    }
+    if (options.max_running_jobs == 0) {
+        options.max_running_jobs = ReadEnvLimit(MAX_RUNNING_JOBS_ENV, options.executor_threads);
+    }
+    if (options.max_queued_jobs == 0) {
+        options.max_queued_jobs = ReadEnvLimit(MAX_QUEUED_JOBS_ENV, DEFAULT_MAX_QUEUED_JOBS);
+    }
+    if (!options.adaptive_concurrency) {
+        options.adaptive_concurrency = ReadEnvInt(ADAPTIVE_CONCURRENCY_ENV, 0) != 0;
+    }
+    read_env_resources(RESOURCES_ENV, options.resources);
+    if (options.health_interval_ms == 0) {
+        options.health_interval_ms = ReadEnvLimit(HEALTH_INTERVAL_ENV, DEFAULT_HEALTH_INTERVAL_MS);
+    }
+    if (options.health_max_saturation == 0) {
+        options.health_max_saturation = ReadEnvLimit(HEALTH_MAX_SATURATION_ENV, DEFAULT_HEALTH_MAX_SATURATION);
+    }
+    if (options.health_max_memory == 0) {
+        options.health_max_memory = ReadEnvLimit(HEALTH_MAX_MEMORY_ENV, DEFAULT_HEALTH_MAX_MEMORY);
+    }
+    if (options.health_max_queued_jobs == 0) {
+        options.health_max_queued_jobs = ReadEnvLimit(HEALTH_MAX_QUEUED_JOBS_ENV,
+            options.max_queued_jobs < 0 ? DEFAULT_MAX_QUEUED_JOBS / 2 : options.max_queued_jobs / 2);
+    }
+    if (options.sync_max_pollers <= 0) {
+        options.sync_max_pollers = std::max(DEFAULT_SYNC_MAX_POLLERS, cores);
+    }
+
+    // gRPC may use half of the container memory, the rest is left to the
+    // job handlers.
+    if (options.resource_quota_bytes == 0 && limits.memory > 0) {
+        options.resource_quota_bytes = limits.memory / 2;
+    }
+
+    // stdout is reserved for the handshake.
+    std::ostringstream cpu_limit;
+    cpu_limit << limits.cpus;
+    std::cerr << "gaia plugin: cpu limit " << (limits.cpus > 0 ? cpu_limit.str() : "none") <<
+        ", memory limit " << (limits.memory > 0 ? std::to_string(limits.memory >> 20) + " MiB" : "none") <<
+        "; executor threads " << options.executor_threads <<
+        ", async queues " << options.async_cq_count <<
+        ", sync max pollers " << options.sync_max_pollers <<
+        ", max running jobs " << options.max_running_jobs <<
+        ", max queued jobs " << options.max_queued_jobs <<
+        (options.adaptive_concurrency ? " (adaptive)" : "") <<
+        ", resource quota " << (options.resource_quota_bytes > 0 ? std::to_string(options.resource_quota_bytes >> 20) + " MiB" : "none") <<
+        std::endl;
+    return options;
+}
+
+// configure_builder applies the gRPC resource options to the builder.
+static void configure_builder(ServerBuilder& builder, const gaia::serve_options& options) GAIA_THROWS {
+    if (options.sync_cq_count > 0) {
+        builder.SetSyncServerOption(ServerBuilder::SyncServerOption::NUM_CQS, options.sync_cq_count);
+    }
+    if (options.sync_min_pollers > 0) {
+        builder.SetSyncServerOption(ServerBuilder::SyncServerOption::MIN_POLLERS, options.sync_min_pollers);
+    }
+    if (options.sync_max_pollers > 0) {
+        builder.SetSyncServerOption(ServerBuilder::SyncServerOption::MAX_POLLERS, options.sync_max_pollers);
+    }
+    if (options.resource_quota_bytes > 0) {
+        grpc::ResourceQuota quota(RESOURCE_QUOTA_NAME);
+        quota.Resize(options.resource_quota_bytes);
+        builder.SetResourceQuota(quota);
+    }
+    if (options.max_receive_message_size != 0) {
+        builder.SetMaxReceiveMessageSize(options.max_receive_message_size);
+    }
+    if (options.max_send_message_size != 0) {
+        builder.SetMaxSendMessageSize(options.max_send_message_size);
+    }
+    if (options.keepalive_time_ms > 0) {
+        builder.AddChannelArgument(GRPC_ARG_KEEPALIVE_TIME_MS, options.keepalive_time_ms);
+    }
+    if (options.keepalive_timeout_ms > 0) {
+        builder.AddChannelArgument(GRPC_ARG_KEEPALIVE_TIMEOUT_MS, options.keepalive_timeout_ms);
+    }
+    if (options.keepalive_permit_without_calls) {
+        builder.AddChannelArgument(GRPC_ARG_KEEPALIVE_PERMIT_WITHOUT_CALLS, 1);
+    }
+    if (!options.compression.empty()) {
+        if (options.compression == "identity") {
+            builder.SetDefaultCompressionAlgorithm(GRPC_COMPRESS_NONE);
+        } else if (options.compression == "deflate") {
+            builder.SetDefaultCompressionAlgorithm(GRPC_COMPRESS_DEFLATE);
+        } else if (options.compression == "gzip") {
+            builder.SetDefaultCompressionAlgorithm(GRPC_COMPRESS_GZIP);
+        } else {
+            throw "unknown compression algorithm: " + options.compression;
+        }
+    }
+}
+
+// The executor, admission control and concurrency limiter of the serving
+// plugin. Used to report their metrics.
+static std::atomic<JobExecutor*> serving_executor(nullptr);
+static std::atomic<AdmissionControl*> serving_admission(nullptr);
+static std::atomic<ConcurrencyLimiter*> serving_limiter(nullptr);
+
+// serve starts the plugin server for the given jobs and blocks until
+// the server has been shut down.
+static void serve(const JobRegistry& registry, const gaia::serve_options& options) GAIA_THROWS {
+    // Allocate space for objects.
+    GRPCPluginImpl service;
+    ServerBuilder builder;
+    service.SetRegistry(&registry);
+    configure_builder(builder, options);
+
+    // Get certificates path from env variables.
+    char* cert_path_p = std::getenv(SERVER_CERT_ENV.c_str());
+    char* key_path_p = std::getenv(SERVER_KEY_ENV.c_str());
+    char* ca_cert_path_p = std::getenv(ROOT_CA_CERT_ENV.c_str());
+
+    // if the env variable was not found it returns a pullptr.
+    if (cert_path_p == nullptr) {
+        throw "certificate env variable was not set: " + SERVER_CERT_ENV;
+    } else if (key_path_p == nullptr) {
+        throw "key env variable was not set: " + SERVER_KEY_ENV;
+    } else if (ca_cert_path_p == nullptr) {
+        throw "root certificate env variable was not set: " + ROOT_CA_CERT_ENV; 
+    }
+    string cert_path(cert_path_p);
+    string key_path(key_path_p);
+    string ca_cert_path(ca_cert_path_p);
+
+    // Load all certificates into memory.
+    string cert_raw;
+    string key_raw;
+    string ca_cert_raw;
+    if (!read_file(cert_path, cert_raw)) {
+        throw "certificate is not a file or does not exist: " + cert_path; 
+    } else if (!read_file(key_path, key_raw)) {
+        throw "key is not a file or does not exist: " + key_path;
+    } else if (!read_file(ca_cert_path, ca_cert_raw)) {
+        throw "root certificate is not a file or does not exist: " + ca_cert_path;
+    }
+
+    // Load and setup mTLS.
+    grpc::SslServerCredentialsOptions::PemKeyCertPair keycert = {
+        key_raw,
+        cert_raw,
+    };
+    grpc::SslServerCredentialsOptions ssl_ops;
+    ssl_ops.pem_root_certs = ca_cert_raw;
+    ssl_ops.pem_key_cert_pairs.push_back(keycert);
+
+    // Allocate memory for the automatic selected port.
+    int * selectedPort = new int(0);
+
+    // Durations of past executions order the jobs of a batch. Without a
+    // history file they are only kept for the lifetime of the plugin.
+    JobHistory history;
+    if (!options.job_history.empty()) {
+        history.Load(options.job_history);
+    }
+    service.SetHistory(&history);
+
+    // Jobs wait for the semaphores of their concurrency policy, then jobs
+    // beyond the limits wait for a slot or are rejected. Like the history
+    // both have to outlive the executor, which releases them.
+    HealthStatus health;
+    health.Set(HEALTH_SERVICE, true);
+    JobSemaphores semaphores(registry.Jobs(), options.resources);
+    service.SetSemaphores(&semaphores);
+    AdmissionControl admission(options.max_running_jobs, options.max_queued_jobs);
+    service.SetAdmission(&admission);
+    serving_admission = &admission;
+
+    // The adaptive limit moves between one job and the configured limit.
+    // The limiter entry of the health service stops serving once it has
+    // backed off completely. The limit and latency ratio are reported by
+    // gaia::AdmissionStats.
+    unique_ptr<ConcurrencyLimiter> limiter;
+    if (options.adaptive_concurrency) {
+        int max_limit = options.max_running_jobs < 0 ? INT_MAX : options.max_running_jobs;
+        int initial = options.max_running_jobs < 0 ? options.executor_threads : options.max_running_jobs;
+        health.Set(HEALTH_SERVICE_LIMITER, true);
+        limiter.reset(new ConcurrencyLimiter(initial, 1, max_limit, [&admission, &health, &limiter](int limit) {
+            admission.SetMaxRunning(limit);
+            health.Set(HEALTH_SERVICE_LIMITER, limit > limiter->MinLimit());
+        }));
+        admission.SetMaxRunning(initial);
+        service.SetLimiter(limiter.get());
+        serving_limiter = limiter.get();
+    }
+
+    // Start the job executor.
+    JobExecutor executor(options.executor_threads);
+    service.SetExecutor(&executor);
+    service.SetLogBufferSize(options.log_buffer_size);
+    serving_executor = &executor;
+
+    // Watch the load of the plugin and of every job with a concurrency
+    // policy. Such a job stops serving on its own once its executions
+    // alone fill all running slots or reach its concurrency limit. Other
+    // jobs get no entry, so the cost of a sample does not grow with the
+    // number of jobs.
+    unique_ptr<HealthMonitor> monitor;
+    if (options.health_interval_ms > 0) {
+        health_thresholds thresholds = {options.health_max_saturation, options.health_max_memory, options.health_max_queued_jobs};
+        monitor.reset(new HealthMonitor(&health, HEALTH_SERVICE, &executor, &admission, thresholds,
+                                        std::chrono::milliseconds(options.health_interval_ms)));
+        const std::vector<gaia::job_wrapper>& jobs = registry.Jobs();
+        for (size_t i = 0; i < jobs.size(); ++i) {
+            const gaia::concurrency_policy& policy = jobs[i].concurrency;
+            if (policy.max_concurrent <= 0 && !policy.exclusive && policy.resources.empty()) {
+                continue;
+            }
+            int max_concurrent = policy.max_concurrent;
+            monitor->Watch(HEALTH_SERVICE_JOB_PREFIX + jobs[i].job.title(), [&service, i, max_concurrent](const gaia::admission_stats& admitted) {
+                int limit = admitted.max_running;
+                if (max_concurrent > 0 && (limit < 0 || max_concurrent < limit)) {
+                    limit = max_concurrent;
+                }
+                return limit > 0 && service.Pending(i) >= limit;
+            });
+        }
+        monitor->Start();
+    }
+
+    // Select the server mode. The sync mode still needs a single
+    // queue for the raw GetJobs method.
+    unique_ptr<AsyncPluginServer> async_server;
+    if (options.server_mode == SERVER_MODE_ASYNC) {
+        async_server.reset(new AsyncPluginServer(&service, options.async_cq_count, options.async_pollers, true));
+    } else {
+        async_server.reset(new AsyncPluginServer(&service, 1, 1, false));
+    }
+
+    // Select the network. The unix socket lives in a private directory
+    // which is removed again once the server has stopped.
+    string network = PROTOCOL_NETWORK;
+    string socket_dir;
+    string address;
+    if (options.network == PROTOCOL_NETWORK_UNIX) {
+        network = PROTOCOL_NETWORK_UNIX;
+        socket_dir = make_socket_dir();
+        address = socket_dir + "/" + SOCKET_NAME;
+        watch_socket_dir(socket_dir, address);
+        builder.AddListeningPort("unix:" + address, grpc::SslServerCredentials(ssl_ops), selectedPort);
+    } else {
+        builder.AddListeningPort(LISTEN_ADDRESS + string(":0"), grpc::SslServerCredentials(ssl_ops), selectedPort);
+    }
+
+    // Enable health check service and start grpc server.
+    grpc::EnableDefaultHealthCheckService(true);
+    async_server->Register(builder);
+    unique_ptr<Server> server(builder.BuildAndStart());
+    if (server == nullptr) {
+        async_server->Shutdown();
+        serving_executor = nullptr;
+        serving_admission = nullptr;
+        serving_limiter = nullptr;
+        delete selectedPort;
+        remove_socket_dir(socket_dir, address);
+        throw ERR_SERVER_START + network;
+    }
+    async_server->Start();
+    if (network == PROTOCOL_NETWORK) {
+        address = LISTEN_ADDRESS + ":" + std::to_string(*selectedPort);
+    }
+         
+    // Publish the health states.
+    health.Attach(server->GetHealthCheckService());
+
+    // Output the address and service name to stdout.
+    // hashicorp go-plugin will use that to establish connection.
+    std::cout << CORE_PROTOCOL_VERSION <<
+        "|" << negotiate_protocol_version(PROTOCOL_VERSIONS_ENV) <<
+        "|" << network <<
+        "|" << address <<
+        "|" << PROTOCOL_TYPE << std::endl << std::flush;
+
+    // clean up a bit and wait until server receives exit signal.
+    delete selectedPort;
+    server->Wait();
+    health.Attach(nullptr);
+    async_server->Shutdown();
+    serving_executor = nullptr;
+    serving_admission = nullptr;
+    serving_limiter = nullptr;
+    remove_socket_dir(socket_dir, address);
+}
+
 namespace gaia {
 
-    void Serve(list<gaia::job> jobs) throw(string) {
-        // Allocate space for objects.
-        GRPCPluginImpl service;
-        ServerBuilder builder;
+    executor_stats ExecutorStats() {
+        JobExecutor* executor = serving_executor.load();
+        if (executor == nullptr) {
+            executor_stats empty = {};
+            return empty;
+        }
+        return executor->Stats();
+    }
 
-        // Transform all given jobs to proto objects.
+    admission_stats AdmissionStats() {
+        AdmissionControl* admission = serving_admission.load();
+        if (admission == nullptr) {
+            admission_stats empty = {};
+            return empty;
+        }
+        admission_stats stats = admission->Stats();
+        ConcurrencyLimiter* limiter = serving_limiter.load();
+        if (limiter != nullptr) {
+            stats.latency_ratio = limiter->Ratio();
+        }
+        return stats;
+    }
+
+    void Serve(list<gaia::job> jobs) GAIA_THROWS {
+        Serve(std::move(jobs), serve_options());
+    }
+
+    void Serve(list<gaia::job> jobs, const serve_options& options) GAIA_THROWS {
+        JobRegistry registry;
+
+        // Validate the job graph and resolve all dependencies.
+        // Throws with every error found in the pipeline.
+        std::vector<const gaia::job*> job_index;
+        for (auto const& job : jobs) {
+            job_index.push_back(&job);
+        }
+        std::vector<std::vector<size_t>> dependencies = validate_jobs(job_index);
+
+        // Every title is hashed once.
+        std::vector<unsigned int> ids;
+        std::vector<uint64_t> ids64;
         for (auto const& job : jobs) {
+            ids.push_back(gaia::JobId(job.title.c_str()));
+            ids64.push_back(gaia::JobId64(job.title.c_str()));
+        }
+
+        // Transform all given jobs to proto objects.
+        for (size_t i = 0; i < job_index.size(); ++i) {
+            const gaia::job& job = *job_index[i];
             Job proto_job;
             
             // Transform manual interaction.
@@ -167,107 +1598,390 @@ namespace gaia {
             }
 
             // Set other data to proto object.
-            proto_job.set_unique_id(fnvHash(job.title.c_str()));
+            proto_job.set_unique_id(ids[i]);
+            proto_job.set_unique_id64(ids64[i]);
             proto_job.set_title(job.title);
             proto_job.set_description(job.description);
 
-            // Resolve dependencies.
-            for (auto const& dependency : job.depends_on) {
-                bool dependency_found;
-                for (auto const& current_job : jobs) {
-                    // Transform titles to lower case for higher matching.
-                    string current_job_title = current_job.title;
-                    string depends_on_title = dependency;
-                    std::transform(current_job_title.begin(), current_job_title.end(), current_job_title.begin(), ::tolower);
-                    std::transform(depends_on_title.begin(), depends_on_title.end(), depends_on_title.begin(), ::tolower);
-                    
-                    // Check if this is the specified dependency.
-                    if (current_job_title.compare(depends_on_title) == 0) {
-                        dependency_found = true;
-                        proto_job.add_dependson(fnvHash(current_job.title.c_str()));
-                        break;
-                    }
-                }
-
-                // Check if dependency has been found.
-                if (!dependency_found) {
-                    throw "job '" + job.title + "' has dependency '" + dependency + "' which is not declared";
-                }
+            // Set resolved dependencies.
+            for (size_t dependency : dependencies[i]) {
+                proto_job.add_dependson(ids[dependency]);
+                proto_job.add_dependson64(ids64[dependency]);
             }
 
             // Create the jobs wrapper object.
             gaia::job_wrapper w = {
                 job.handler,
-                proto_job,
+                std::move(proto_job),
+                job.args_handler,
+#ifdef GAIA_COROUTINES
+                job.task_handler,
+#endif
+                job.concurrency,
             };
-            service.PushCachedJobs(&w);
-        }
-
-        // ApplyUnique checks if given jobs includes a duplicate.
-        // If so it will throw an error.
-        service.ApplyUnique();
-
-        // Get certificates path from env variables.
-        char* cert_path_p = std::getenv(SERVER_CERT_ENV.c_str());
-        char* key_path_p = std::getenv(SERVER_KEY_ENV.c_str());
-        char* ca_cert_path_p = std::getenv(ROOT_CA_CERT_ENV.c_str());
-
-        // if the env variable was not found it returns a pullptr.
-        if (cert_path_p == nullptr) {
-            throw "certificate env variable was not set: " + SERVER_CERT_ENV;
-        } else if (key_path_p == nullptr) {
-            throw "key env variable was not set: " + SERVER_KEY_ENV;
-        } else if (ca_cert_path_p == nullptr) {
-            throw "root certificate env variable was not set: " + ROOT_CA_CERT_ENV; 
-        }
-        string cert_path(cert_path_p);
-        string key_path(key_path_p);
-        string ca_cert_path(ca_cert_path_p);
-
-        // Load all certificates into memory.
-        string cert_raw;
-        string key_raw;
-        string ca_cert_raw;
-        if (!read_file(cert_path, cert_raw)) {
-            throw "certificate is not a file or does not exist: " + cert_path; 
-        } else if (!read_file(key_path, key_raw)) {
-            throw "key is not a file or does not exist: " + key_path;
-        } else if (!read_file(ca_cert_path, ca_cert_raw)) {
-            throw "root certificate is not a file or does not exist: " + ca_cert_path;
-        }
-
-        // Load and setup mTLS.
-        grpc::SslServerCredentialsOptions::PemKeyCertPair keycert = {
-            key_raw,
-            cert_raw,
-        };
-        grpc::SslServerCredentialsOptions ssl_ops;
-        ssl_ops.pem_root_certs = ca_cert_raw;
-        ssl_ops.pem_key_cert_pairs.push_back(keycert);
+            registry.Add(std::move(w));
+        }
+
+        // Build the job lookup tables. Throws if given jobs include
+        // a duplicate or their ids collide.
+        registry.Build(wide_job_ids());
+        serve(registry, resolve_options(options));
+    };
 
-        // Allocate memory for the automatic selected port.
-        int * selectedPort = new int(0);
+    void Serve(const static_job* jobs, size_t count) GAIA_THROWS {
+        Serve(jobs, count, serve_options());
+    }
 
-        // Enable health check service and start grpc server.
-        grpc::EnableDefaultHealthCheckService(true);
-        builder.AddListeningPort(LISTEN_ADDRESS + string(":0"), grpc::SslServerCredentials(ssl_ops), selectedPort);
-        builder.RegisterService(&service);
-        unique_ptr<Server> server(builder.BuildAndStart());
-             
-        // Define health service.
-        grpc::HealthCheckServiceInterface* health_svc = server->GetHealthCheckService();
-        health_svc->SetServingStatus("plugin", true);
-
-        // Output the address and service name to stdout.
-        // hashicorp go-plugin will use that to establish connection.
-        std::cout << CORE_PROTOCOL_VERSION <<
-            "|" << PROTOCOL_VERSION <<
-            "|" << PROTOCOL_NETWORK <<
-            "|" << LISTEN_ADDRESS + ":" << *selectedPort <<
-            "|" << PROTOCOL_TYPE << std::endl << std::flush;
-
-        // clean up a bit and wait until server receives exit signal.
-        delete selectedPort;
-        server->Wait();
+    void Serve(const static_job* jobs, size_t count, const serve_options& options) GAIA_THROWS {
+        JobRegistry registry;
+
+        // Ids, dependencies and type names have been computed at
+        // compile time, so we only copy the table.
+        for (size_t i = 0; i < count; ++i) {
+            const static_job& job = jobs[i];
+            Job proto_job;
+
+            ManualInteraction* ma = proto_job.mutable_interaction();
+            ma->set_description(job.interaction_description);
+            ma->set_type(job.interaction_type);
+            ma->set_value(job.interaction_value);
+
+            for (size_t a = 0; a < job.args_count; ++a) {
+                Argument* arg = proto_job.add_args();
+                arg->set_description(job.args[a].description);
+                arg->set_type(job.args[a].type);
+                arg->set_key(job.args[a].key);
+                arg->set_value(job.args[a].value);
+            }
+
+            proto_job.set_unique_id(job.id);
+            proto_job.set_unique_id64(job.id64);
+            proto_job.set_title(job.title);
+            proto_job.set_description(job.description);
+            for (size_t d = 0; d < job.depends_on_count; ++d) {
+                proto_job.add_dependson(job.depends_on[d].id);
+                proto_job.add_dependson64(job.depends_on[d].id64);
+            }
+
+            gaia::concurrency_policy concurrency;
+            concurrency.max_concurrent = job.max_concurrent;
+            concurrency.exclusive = job.exclusive;
+            for (size_t r = 0; r < job.resources_count; ++r) {
+                concurrency.resources.push_back(job.resources[r]);
+            }
+
+            gaia::job_wrapper w = {
+                job.handler,
+                std::move(proto_job),
+                job.args_handler,
+#ifdef GAIA_COROUTINES
+                job.task_handler,
+#endif
+                std::move(concurrency),
+            };
+            registry.Add(std::move(w));
+        }
+
+        // Build the job lookup tables. Throws if given jobs include
+        // a duplicate or their ids collide.
+        registry.Build(wide_job_ids());
+        serve(registry, resolve_options(options));
     };
+
+    // Argument views with at most this many arguments are searched
+    // linearly, which is faster than hashing the key.
+    static const size_t ARGUMENTS_LINEAR_SEARCH = 8;
+
+    static size_t hash_key(grpc::string_ref key) {
+        size_t hash = 2166136261u;
+        for (size_t i = 0; i < key.size(); ++i) {
+            hash ^= static_cast<unsigned char>(key.data()[i]);
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
+    struct cancellation_token::state {
+        std::atomic<bool> cancelled;
+        std::mutex mutex;
+        int next_id;
+        std::map<int, std::function<void()>> callbacks;
+    };
+
+    cancellation_token::cancellation_token() : shared(std::make_shared<state>()) {
+        shared->cancelled = false;
+        shared->next_id = 0;
+    }
+
+    bool cancellation_token::IsCancelled() const {
+        return shared->cancelled.load();
+    }
+
+    int cancellation_token::OnCancel(std::function<void()> callback) const {
+        {
+            std::lock_guard<std::mutex> lock(shared->mutex);
+            if (!shared->cancelled.load()) {
+                int id = shared->next_id++;
+                shared->callbacks[id] = std::move(callback);
+                return id;
+            }
+        }
+        callback();
+        return -1;
+    }
+
+    void cancellation_token::Unregister(int id) const {
+        std::lock_guard<std::mutex> lock(shared->mutex);
+        shared->callbacks.erase(id);
+    }
+
+    void cancellation_token::Cancel() const {
+        std::map<int, std::function<void()>> callbacks;
+        {
+            std::lock_guard<std::mutex> lock(shared->mutex);
+            if (shared->cancelled.exchange(true)) {
+                return;
+            }
+            callbacks.swap(shared->callbacks);
+        }
+        for (auto & callback : callbacks) {
+            callback.second();
+        }
+    }
+
+    cancellation_token CancellationToken() {
+        static const cancellation_token never;
+        return current_job == nullptr ? never : current_job->token;
+    }
+
+    bool Sleep(std::chrono::steady_clock::duration duration) {
+        cancellation_token token = CancellationToken();
+        std::shared_ptr<std::mutex> mutex = std::make_shared<std::mutex>();
+        std::shared_ptr<std::condition_variable> cv = std::make_shared<std::condition_variable>();
+        int id = token.OnCancel([mutex, cv]() {
+            std::lock_guard<std::mutex> lock(*mutex);
+            cv->notify_all();
+        });
+        {
+            std::unique_lock<std::mutex> lock(*mutex);
+            cv->wait_for(lock, duration, [&token]() {
+                return token.IsCancelled();
+            });
+        }
+        token.Unregister(id);
+        return !token.IsCancelled();
+    }
+
+    bool WaitProcess(pid_t pid, int& status) {
+        // Poll with a growing interval, so short processes return fast.
+        std::chrono::milliseconds interval(1);
+        for (;;) {
+            pid_t result = waitpid(pid, &status, WNOHANG);
+            if (result == pid) {
+                return true;
+            } else if (result < 0) {
+                return false;
+            }
+            if (!Sleep(interval)) {
+                kill(pid, SIGKILL);
+                waitpid(pid, &status, 0);
+                return false;
+            }
+            interval = std::min(interval * 2, PROCESS_POLL_MAX_INTERVAL);
+        }
+    }
+
+    bool ReadAll(int fd, string& data) {
+        cancellation_token token = CancellationToken();
+        char buffer[16384];
+        for (;;) {
+            if (token.IsCancelled()) {
+                return false;
+            }
+            pollfd readable = { fd, POLLIN, 0 };
+            int ready = poll(&readable, 1, CANCEL_POLL_INTERVAL.count());
+            if (ready < 0 && errno != EINTR) {
+                return false;
+            } else if (ready <= 0) {
+                continue;
+            }
+            ssize_t n = read(fd, buffer, sizeof(buffer));
+            if (n == 0) {
+                return true;
+            } else if (n < 0) {
+                if (errno != EINTR && errno != EAGAIN) {
+                    return false;
+                }
+                continue;
+            }
+            data.append(buffer, n);
+        }
+    }
+
+    bool WriteLog(const char* data, size_t size) {
+        if (current_job == nullptr || !current_job->log) {
+            std::cerr.write(data, size);
+            return true;
+        }
+        return current_job->log->Write(data, size);
+    }
+
+    bool WriteLog(const string& data) {
+        return WriteLog(data.data(), data.size());
+    }
+
+#ifdef GAIA_COROUTINES
+    // resume continues a suspended job on the executor with its context
+    // as current context.
+    static void resume(std::coroutine_handle<> handle, job_context context) {
+        JobExecutor* executor = serving_executor.load();
+        if (executor == nullptr) {
+            JobScope scope(context);
+            handle.resume();
+            return;
+        }
+        executor->Submit([handle, context]() {
+            JobScope scope(context);
+            handle.resume();
+        });
+    }
+
+    // wait_state is shared by a suspended job and the callbacks which
+    // resume it. The job resumes on the second arrival, once the awaited
+    // event has fired and await_suspend has registered all callbacks, so
+    // await_resume always sees the cancel id and status.
+    struct wait_state {
+        std::coroutine_handle<> handle;
+        job_context context;
+        std::atomic<int> arrivals{0};
+        std::atomic<bool> fired{false};
+        int cancel_id = -1;
+        int status = 0;
+    };
+
+    static void arrive(const std::shared_ptr<wait_state>& state) {
+        if (state->arrivals.fetch_add(1, std::memory_order_acq_rel) == 1) {
+            resume(state->handle, state->context);
+        }
+    }
+
+    void sleep_awaitable::await_suspend(std::coroutine_handle<> handle) {
+        std::shared_ptr<wait_state> shared = std::make_shared<wait_state>();
+        shared->handle = handle;
+        shared->context = current_context();
+        state = shared;
+
+        // Either the timer or the token resumes the job, whichever is first.
+        std::function<void()> wake = [shared]() {
+            if (!shared->fired.exchange(true)) {
+                arrive(shared);
+            }
+        };
+        shared->cancel_id = shared->context.token.OnCancel(wake);
+        Reactor::Instance().AddTimer(std::chrono::steady_clock::now() + duration, wake);
+
+        // The job may resume and finish right away, so the frame is not
+        // touched after this.
+        arrive(shared);
+    }
+
+    void sleep_awaitable::await_resume() {
+        if (state && state->cancel_id >= 0) {
+            CancellationToken().Unregister(state->cancel_id);
+        }
+    }
+
+    void process_awaitable::await_suspend(std::coroutine_handle<> handle) {
+        std::shared_ptr<wait_state> shared = std::make_shared<wait_state>();
+        shared->handle = handle;
+        shared->context = current_context();
+        state = shared;
+
+        pid_t child = pid;
+        Reactor::Instance().WatchProcess(child, [shared](int wait_status) {
+            shared->status = wait_status;
+            arrive(shared);
+        });
+
+        // The reactor still reaps the killed process and resumes the job.
+        // It leaves processes alone once reaped, as their pid may be reused.
+        shared->cancel_id = shared->context.token.OnCancel([child]() {
+            Reactor::Instance().KillProcess(child);
+        });
+        arrive(shared);
+    }
+
+    int process_awaitable::await_resume() {
+        if (state->cancel_id >= 0) {
+            CancellationToken().Unregister(state->cancel_id);
+        }
+        return state->status;
+    }
+
+    void file_awaitable::await_suspend(std::coroutine_handle<> handle) {
+        job_context context = current_context();
+        Reactor::Instance().RunBlocking([this, handle, context]() {
+            if (write) {
+                std::ofstream file(path.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+                ok = file.is_open() && file.write(data.data(), data.size()).good();
+            } else {
+                ok = read_file(path, data);
+            }
+            resume(handle, context);
+        });
+    }
+
+    string file_awaitable::await_resume() {
+        if (!ok) {
+            throw (write ? "cannot write file: " : "cannot read file: ") + path;
+        }
+        return std::move(data);
+    }
+#endif
+
+    arguments::arguments(std::vector<argument_ref> refs) : refs(std::move(refs)) {
+        if (this->refs.size() <= ARGUMENTS_LINEAR_SEARCH) {
+            return;
+        }
+
+        // Open addressing table of argument positions, at most half full.
+        size_t size = 1;
+        while (size < this->refs.size() * 2) {
+            size <<= 1;
+        }
+        index.assign(size, -1);
+        for (size_t i = 0; i < this->refs.size(); ++i) {
+            size_t slot = hash_key(this->refs[i].key) & (size - 1);
+            while (index[slot] >= 0) {
+                // The first argument wins if a key is given twice.
+                if (this->refs[index[slot]].key == this->refs[i].key) {
+                    break;
+                }
+                slot = (slot + 1) & (size - 1);
+            }
+            if (index[slot] < 0) {
+                index[slot] = i;
+            }
+        }
+    }
+
+    const argument_ref* arguments::Find(grpc::string_ref key) const {
+        if (index.empty()) {
+            for (auto const& ref : refs) {
+                if (ref.key == key) {
+                    return &ref;
+                }
+            }
+            return nullptr;
+        }
+
+        size_t slot = hash_key(key) & (index.size() - 1);
+        while (index[slot] >= 0) {
+            if (refs[index[slot]].key == key) {
+                return &refs[index[slot]];
+            }
+            slot = (slot + 1) & (index.size() - 1);
+        }
+        return nullptr;
+    }
 }
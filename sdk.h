@@ -1,15 +1,87 @@
 #ifndef SDK_H
 #define SDK_H
 
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
 #include <string>
 #include <map>
 #include <list>
+#include <vector>
+#include <sys/types.h>
+#include <grpcpp/support/string_ref.h>
 #include "plugin.grpc.pb.h"
 
 using std::string;
 using std::list;
 using proto::Job;
 
+// Dynamic exception specifications have been removed in C++17.
+// Handlers may use GAIA_THROWS to build with every language version.
+#if __cplusplus >= 201703L
+#define GAIA_THROWS
+#else
+#define GAIA_THROWS throw(string)
+#endif
+
+namespace gaia {
+    // cancellation_token fires when Gaia cancels the execution of a job
+    // or its deadline expires. Handlers should check it and return early.
+    // Copies share the same state.
+    class cancellation_token {
+        public:
+            cancellation_token();
+
+            bool IsCancelled() const;
+
+            // OnCancel calls callback once the token fires, right away if
+            // it already has. The returned id removes the callback again.
+            int OnCancel(std::function<void()> callback) const;
+
+            void Unregister(int id) const;
+
+            // Cancel fires the token. Used by the SDK.
+            void Cancel() const;
+
+        private:
+            struct state;
+            std::shared_ptr<state> shared;
+    };
+
+    // CancellationToken returns the token of the job which runs on the
+    // calling thread. Outside of a job the token never fires.
+    cancellation_token CancellationToken();
+
+    // Sleep blocks for the given duration. Returns false if the job has
+    // been cancelled before.
+    bool Sleep(std::chrono::steady_clock::duration duration);
+
+    // WaitProcess blocks until the given child process has exited and
+    // stores its wait status. If the job is cancelled first, the process
+    // is killed and false is returned.
+    bool WaitProcess(pid_t pid, int& status);
+
+    // ReadAll reads from the given file descriptor until end of file,
+    // e.g. the output pipe of a child process. Returns false on error or
+    // if the job has been cancelled.
+    bool ReadAll(int fd, string& data);
+
+    // WriteLog sends output of the running job to Gaia while the job
+    // runs. It blocks while the log buffer of the job is full and returns
+    // false once Gaia stopped reading. Jobs which are not executed as
+    // stream write to stderr.
+    bool WriteLog(const char* data, size_t size);
+    bool WriteLog(const string& data);
+}
+
+// Coroutine job handlers are available in C++20 builds.
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L
+#define GAIA_COROUTINES
+#include "task.h"
+#endif
+
 namespace gaia {
     struct InputType {
         enum class input_type {
@@ -20,15 +92,66 @@ namespace gaia {
         };
     };
 
+    constexpr const char* TypeName (InputType::input_type es) {
+        switch (es) {
+            case InputType::input_type::textfield: return "textfield";
+            case InputType::input_type::textarea: return "textarea";
+            case InputType::input_type::boolean: return "boolean";
+            case InputType::input_type::vault: return "vault";
+        }
+        return "Out of range";
+    }
+
     inline const string ToString (InputType::input_type es) {
-        const std::map<InputType::input_type,const string> EnumStrings {
-            { InputType::input_type::textfield, "textfield" },
-            { InputType::input_type::textarea, "textarea" },
-            { InputType::input_type::boolean, "boolean" },
-            { InputType::input_type::vault, "vault" }
-        };
-        auto it = EnumStrings.find(es);
-        return it == EnumStrings.end() ? "Out of range" : it->second;
+        return TypeName(es);
+    }
+
+    // JobId returns the 32 bit id of the job with the given title.
+    // It is the 32 bit FNV-1a hash of the title including the
+    // terminating null character.
+    constexpr unsigned int JobId(const char* title) {
+        unsigned int hash = 2166136261u;
+        do {
+            hash ^= static_cast<unsigned int>(*title);
+            hash *= 16777619u;
+        } while (*title++ != '\0');
+        return hash;
+    }
+
+    // JobId64 returns the 64 bit id of the job with the given title. It
+    // is the MurmurHash64A hash of the title, read in little endian
+    // order, so ids are the same on every platform.
+    constexpr uint64_t JobId64(const char* title) {
+        const uint64_t m = 0xc6a4a7935bd1e995ull;
+        const int r = 47;
+        size_t length = 0;
+        while (title[length] != '\0') {
+            ++length;
+        }
+
+        uint64_t hash = length * m;
+        size_t i = 0;
+        for (; i + 8 <= length; i += 8) {
+            uint64_t k = 0;
+            for (size_t b = 0; b < 8; ++b) {
+                k |= static_cast<uint64_t>(static_cast<unsigned char>(title[i + b])) << (8 * b);
+            }
+            k *= m;
+            k ^= k >> r;
+            k *= m;
+            hash ^= k;
+            hash *= m;
+        }
+        if (i < length) {
+            for (size_t b = 0; i + b < length; ++b) {
+                hash ^= static_cast<uint64_t>(static_cast<unsigned char>(title[i + b])) << (8 * b);
+            }
+            hash *= m;
+        }
+        hash ^= hash >> r;
+        hash *= m;
+        hash ^= hash >> r;
+        return hash;
     }
 
     struct argument {
@@ -38,27 +161,415 @@ namespace gaia {
         string value;
     };
 
+    // argument_ref refers to the key and value of an argument in an
+    // execution request without copying them.
+    struct argument_ref {
+        grpc::string_ref key;
+        grpc::string_ref value;
+    };
+
+    // arguments is a contiguous view of the arguments of an execution
+    // request. Keys and values point into the request and are only
+    // valid while the handler runs.
+    class arguments {
+        public:
+            explicit arguments(std::vector<argument_ref> refs);
+
+            size_t Size() const {
+                return refs.size();
+            }
+
+            const argument_ref& operator[](size_t i) const {
+                return refs[i];
+            }
+
+            const argument_ref* begin() const {
+                return refs.data();
+            }
+
+            const argument_ref* end() const {
+                return refs.data() + refs.size();
+            }
+
+            // Find returns the argument with the given key or nullptr.
+            // Lookups use a hash index when there are many arguments.
+            const argument_ref* Find(grpc::string_ref key) const;
+
+            // Value returns the value of the given key. It is empty if
+            // the key does not exist.
+            grpc::string_ref Value(grpc::string_ref key) const {
+                const argument_ref* arg = Find(key);
+                return arg == nullptr ? grpc::string_ref() : arg->value;
+            }
+
+        private:
+            std::vector<argument_ref> refs;
+            std::vector<int> index;
+    };
+
     struct manual_interaction {
         string description;
         InputType::input_type type;
         string value;
     };
 
+    // concurrency_policy limits how a job runs next to other jobs. The
+    // SDK enforces it before the handler starts, waiting executions hold
+    // no thread.
+    struct concurrency_policy {
+        // Executions of the job which may run at the same time. 0 means
+        // no limit.
+        int max_concurrent = 0;
+
+        // An exclusive job runs while no other job of the plugin runs.
+        bool exclusive = false;
+
+        // Named shared resources, e.g. "docker" or "db". Every execution
+        // holds a slot of each of them while it runs. Resources have a
+        // single slot unless serve_options::resources says otherwise.
+        list<string> resources;
+    };
+
     struct job {
-        void (*handler)(list<argument>) throw(string);
+        void (*handler)(list<argument>) GAIA_THROWS;
         string title;
         string description;
         list<string> depends_on;
         list<argument> args;
         manual_interaction interaction;
+        concurrency_policy concurrency;
+
+        // args_handler is used instead of handler if set. It receives
+        // the request arguments without copying them.
+        void (*args_handler)(const arguments&) GAIA_THROWS = nullptr;
+
+#ifdef GAIA_COROUTINES
+        // task_handler is used instead of handler if set. The job runs
+        // as coroutine and does not hold an executor thread while it
+        // awaits timers, processes or file I/O.
+        task (*task_handler)(const arguments&) = nullptr;
+#endif
     };
 
     struct job_wrapper {
-        void (*handler)(list<argument>) throw(string);
+        void (*handler)(list<argument>) GAIA_THROWS;
         Job job;
+        void (*args_handler)(const arguments&) GAIA_THROWS = nullptr;
+#ifdef GAIA_COROUTINES
+        task (*task_handler)(const arguments&) = nullptr;
+#endif
+        concurrency_policy concurrency;
+    };
+
+    // static_argument is an argument of a job declared at compile time.
+    struct static_argument {
+        const char* description;
+        const char* type;
+        const char* key;
+        const char* value;
+
+        constexpr static_argument(const char* description, InputType::input_type type, const char* key, const char* value = "")
+            : description(description), type(TypeName(type)), key(key), value(value) {}
     };
 
-    void Serve(list<job>) throw(string);
+    // static_dependency refers to another job of a static job table.
+    // The title must be spelled exactly like the title of that job.
+    struct static_dependency {
+        const char* title;
+        unsigned int id;
+        uint64_t id64;
+
+        constexpr static_dependency(const char* title) : title(title), id(JobId(title)), id64(JobId64(title)) {}
+    };
+
+    // static_job is a job declared at compile time. Ids and type names
+    // are computed by the compiler, so Serve only copies the table.
+    //
+    //   constexpr gaia::static_dependency deploy_deps[] = { "Build" };
+    //   constexpr const char* deploy_resources[] = { "docker" };
+    //   constexpr gaia::static_job jobs[] = {
+    //       gaia::static_job(&Build, "Build", "Builds the project").MaxConcurrent(2),
+    //       gaia::static_job(&Deploy, "Deploy", "Deploys the project").DependsOn(deploy_deps).Resources(deploy_resources),
+    //   };
+    //   static_assert(gaia::ValidJobs(jobs), "invalid pipeline");
+    struct static_job {
+        void (*handler)(list<argument>) GAIA_THROWS;
+        void (*args_handler)(const arguments&) GAIA_THROWS;
+        const char* title;
+        const char* description;
+        unsigned int id;
+        uint64_t id64;
+        const static_dependency* depends_on;
+        size_t depends_on_count;
+        const static_argument* args;
+        size_t args_count;
+        const char* interaction_description;
+        const char* interaction_type;
+        const char* interaction_value;
+#ifdef GAIA_COROUTINES
+        task (*task_handler)(const arguments&) = nullptr;
+#endif
+        // See concurrency_policy.
+        int max_concurrent = 0;
+        bool exclusive = false;
+        const char* const* resources = nullptr;
+        size_t resources_count = 0;
+
+        constexpr static_job(void (*handler)(list<argument>) GAIA_THROWS, const char* title, const char* description)
+            : handler(handler), args_handler(nullptr), title(title), description(description), id(JobId(title)), id64(JobId64(title)),
+              depends_on(nullptr), depends_on_count(0), args(nullptr), args_count(0),
+              interaction_description(""), interaction_type(TypeName(InputType::input_type::textfield)),
+              interaction_value("") {}
+
+        constexpr static_job(void (*args_handler)(const arguments&) GAIA_THROWS, const char* title, const char* description)
+            : handler(nullptr), args_handler(args_handler), title(title), description(description), id(JobId(title)), id64(JobId64(title)),
+              depends_on(nullptr), depends_on_count(0), args(nullptr), args_count(0),
+              interaction_description(""), interaction_type(TypeName(InputType::input_type::textfield)),
+              interaction_value("") {}
+
+#ifdef GAIA_COROUTINES
+        constexpr static_job(task (*task_handler)(const arguments&), const char* title, const char* description)
+            : static_job(static_cast<void (*)(list<argument>)>(nullptr), title, description) {
+            this->task_handler = task_handler;
+        }
+#endif
+
+        template <size_t N>
+        constexpr static_job DependsOn(const static_dependency (&dependencies)[N]) const {
+            static_job job = *this;
+            job.depends_on = dependencies;
+            job.depends_on_count = N;
+            return job;
+        }
+
+        template <size_t N>
+        constexpr static_job Args(const static_argument (&arguments)[N]) const {
+            static_job job = *this;
+            job.args = arguments;
+            job.args_count = N;
+            return job;
+        }
+
+        constexpr static_job Interaction(const char* description, InputType::input_type type, const char* value = "") const {
+            static_job job = *this;
+            job.interaction_description = description;
+            job.interaction_type = TypeName(type);
+            job.interaction_value = value;
+            return job;
+        }
+
+        constexpr static_job MaxConcurrent(int max) const {
+            static_job job = *this;
+            job.max_concurrent = max;
+            return job;
+        }
+
+        constexpr static_job Exclusive() const {
+            static_job job = *this;
+            job.exclusive = true;
+            return job;
+        }
+
+        template <size_t N>
+        constexpr static_job Resources(const char* const (&names)[N]) const {
+            static_job job = *this;
+            job.resources = names;
+            job.resources_count = N;
+            return job;
+        }
+    };
+
+    // ValidJobs checks a static job table at compile time. It returns
+    // false if two jobs share a 64 bit id, a dependency is not declared or
+    // the dependencies contain a cycle. Collisions of the 32 bit ids are
+    // checked by Serve, since they only matter to older Gaia versions.
+    template <size_t N>
+    constexpr bool ValidJobs(const static_job (&jobs)[N]) {
+        // Ids must be unique and every dependency must be declared.
+        for (size_t i = 0; i < N; ++i) {
+            for (size_t j = i + 1; j < N; ++j) {
+                if (jobs[i].id64 == jobs[j].id64) {
+                    return false;
+                }
+            }
+            for (size_t d = 0; d < jobs[i].depends_on_count; ++d) {
+                size_t found = 0;
+                while (found < N && jobs[found].id64 != jobs[i].depends_on[d].id64) {
+                    ++found;
+                }
+                if (found == N) {
+                    return false;
+                }
+            }
+        }
+
+        // Depth first search over the dependencies. Reaching a job
+        // which is still on the path means a cycle.
+        char state[N] = {};
+        size_t path[N] = {};
+        size_t edge[N] = {};
+        for (size_t root = 0; root < N; ++root) {
+            if (state[root] != 0) {
+                continue;
+            }
+            size_t depth = 0;
+            path[0] = root;
+            edge[0] = 0;
+            state[root] = 1;
+            for (;;) {
+                const static_job& current = jobs[path[depth]];
+                if (edge[depth] == current.depends_on_count) {
+                    state[path[depth]] = 2;
+                    if (depth == 0) {
+                        break;
+                    }
+                    --depth;
+                    continue;
+                }
+                uint64_t id = current.depends_on[edge[depth]++].id64;
+                size_t next = 0;
+                while (jobs[next].id64 != id) {
+                    ++next;
+                }
+                if (state[next] == 1) {
+                    return false;
+                }
+                if (state[next] == 0) {
+                    state[next] = 1;
+                    ++depth;
+                    path[depth] = next;
+                    edge[depth] = 0;
+                }
+            }
+        }
+        return true;
+    }
+
+    // executor_stats is a snapshot of the job executor metrics.
+    struct executor_stats {
+        int threads;
+        long queued;
+        long running;
+        long completed;
+        long stolen;
+        long max_queued;
+    };
+
+    // admission_stats is a snapshot of the admission control metrics.
+    // Wait times are in microseconds and cover the jobs which had to
+    // queue for a free slot. With the adaptive concurrency limit on,
+    // max_running is the current limit and latency_ratio the smoothed
+    // ratio of observed to baseline job latency it follows, otherwise the
+    // ratio is 0.
+    struct admission_stats {
+        int max_running;
+        int max_queued;
+        long running;
+        long queued;
+        long max_queue_depth;
+        long admitted;
+        long rejected;
+        long cancelled;
+        long waited;
+        long total_wait_us;
+        long max_wait_us;
+        double latency_ratio;
+    };
+
+    // serve_options configures the plugin server. Fields left at zero or
+    // empty fall back to the matching GAIA_PLUGIN_* environment variable,
+    // if there is one, and then to the default of the SDK or gRPC.
+    struct serve_options {
+        // "sync" or "async", see GAIA_PLUGIN_SERVER_MODE.
+        string server_mode;
+
+        // "tcp" or "unix", see GAIA_PLUGIN_NETWORK.
+        string network;
+
+        // Threads which run job handlers. Defaults to one per core.
+        int executor_threads = 0;
+
+        // Completion queues and poller threads per queue in async mode.
+        int async_cq_count = 0;
+        int async_pollers = 0;
+
+        // Jobs which run at the same time and jobs which may wait for a
+        // free slot before further calls fail with RESOURCE_EXHAUSTED.
+        // Default to one running job per executor thread and
+        // 64 waiting ones, -1 removes the limit.
+        int max_running_jobs = 0;
+        int max_queued_jobs = 0;
+
+        // Adapts the number of running jobs to the observed job latency,
+        // between one and max_running_jobs. See
+        // GAIA_PLUGIN_ADAPTIVE_CONCURRENCY.
+        bool adaptive_concurrency = false;
+
+        // Interval in milliseconds at which the load is checked, -1 turns
+        // the health monitor off. The plugin entry of the health service
+        // stops serving while the executor saturation in percent of its
+        // threads, the memory usage in percent or the queued jobs cross
+        // their threshold. -1 disables a threshold. Default to 1000ms,
+        // 200%, 90% and half of max_queued_jobs.
+        int health_interval_ms = 0;
+        int health_max_saturation = 0;
+        int health_max_memory = 0;
+        int health_max_queued_jobs = 0;
+
+        // Completion queues and poller threads of the synchronous server.
+        int sync_cq_count = 0;
+        int sync_min_pollers = 0;
+        int sync_max_pollers = 0;
+
+        // Memory limit of the gRPC resource quota in bytes.
+        size_t resource_quota_bytes = 0;
+
+        // Largest message in bytes the server receives and sends. -1
+        // removes the limit.
+        int max_receive_message_size = 0;
+        int max_send_message_size = 0;
+
+        // Interval and timeout of keepalive pings in milliseconds.
+        int keepalive_time_ms = 0;
+        int keepalive_timeout_ms = 0;
+        bool keepalive_permit_without_calls = false;
+
+        // Default compression of responses, "identity", "deflate" or "gzip".
+        string compression;
+
+        // Size of the log buffer of a streamed job in bytes.
+        int log_buffer_size = 0;
+
+        // Path of the job duration history file.
+        string job_history;
+
+        // Slots of the named resources of concurrency_policy. Resources
+        // which are not listed have one slot. See GAIA_PLUGIN_RESOURCES.
+        std::map<string, int> resources;
+    };
+
+    void Serve(list<job>) GAIA_THROWS;
+    void Serve(list<job>, const serve_options& options) GAIA_THROWS;
+    void Serve(const static_job* jobs, size_t count) GAIA_THROWS;
+    void Serve(const static_job* jobs, size_t count, const serve_options& options) GAIA_THROWS;
+
+    template <size_t N>
+    void Serve(const static_job (&jobs)[N]) GAIA_THROWS {
+        Serve(jobs, N);
+    }
+
+    template <size_t N>
+    void Serve(const static_job (&jobs)[N], const serve_options& options) GAIA_THROWS {
+        Serve(jobs, N, options);
+    }
+
+    // ExecutorStats returns the metrics of the executor which runs the
+    // job handlers of the serving plugin.
+    executor_stats ExecutorStats();
+
+    // AdmissionStats returns the metrics of the admission control of the
+    // serving plugin.
+    admission_stats AdmissionStats();
 }
 
 #endif 
@@ -0,0 +1,188 @@
+#ifndef TASK_H
+#define TASK_H
+
+#include <chrono>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <sys/types.h>
+
+namespace gaia {
+    // task is the result of a coroutine job handler. A task starts
+    // suspended and can be awaited by another task.
+    //
+    //   gaia::task Build(const gaia::arguments& args) {
+    //       pid_t pid = StartCompiler(args);
+    //       int status = co_await gaia::WaitProcess(pid);
+    //       ...
+    //   }
+    class task {
+        public:
+            struct promise_type;
+            typedef std::coroutine_handle<promise_type> handle_type;
+
+            struct promise_type {
+                std::exception_ptr error;
+                std::coroutine_handle<> continuation;
+                std::function<void(std::exception_ptr)> done;
+
+                // final_awaiter resumes the awaiting task or reports the
+                // result of a top level task to the SDK.
+                struct final_awaiter {
+                    bool await_ready() noexcept {
+                        return false;
+                    }
+
+                    std::coroutine_handle<> await_suspend(handle_type handle) noexcept {
+                        promise_type& promise = handle.promise();
+                        if (promise.continuation) {
+                            return promise.continuation;
+                        }
+
+                        // done may destroy this coroutine, so nothing in
+                        // the frame is touched after calling it.
+                        std::function<void(std::exception_ptr)> done = std::move(promise.done);
+                        done(promise.error);
+                        return std::noop_coroutine();
+                    }
+
+                    void await_resume() noexcept {}
+                };
+
+                task get_return_object() {
+                    return task(handle_type::from_promise(*this));
+                }
+
+                std::suspend_always initial_suspend() noexcept {
+                    return {};
+                }
+
+                final_awaiter final_suspend() noexcept {
+                    return {};
+                }
+
+                void return_void() {}
+
+                void unhandled_exception() {
+                    error = std::current_exception();
+                }
+            };
+
+            task() : handle(nullptr) {}
+
+            task(task&& other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+
+            task& operator=(task&& other) noexcept {
+                if (this != &other) {
+                    if (handle) {
+                        handle.destroy();
+                    }
+                    handle = std::exchange(other.handle, nullptr);
+                }
+                return *this;
+            }
+
+            ~task() {
+                if (handle) {
+                    handle.destroy();
+                }
+            }
+
+            // Awaiting a task runs it and rethrows what it has thrown.
+            bool await_ready() const noexcept {
+                return !handle || handle.done();
+            }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+                handle.promise().continuation = awaiting;
+                return handle;
+            }
+
+            void await_resume() {
+                if (handle.promise().error) {
+                    std::rethrow_exception(handle.promise().error);
+                }
+            }
+
+            // Start runs a top level task. done is called with the thrown
+            // exception, if any, once the task has finished. Used by the SDK.
+            void Start(std::function<void(std::exception_ptr)> done) {
+                handle.promise().done = std::move(done);
+                handle.resume();
+            }
+
+        private:
+            explicit task(handle_type handle) : handle(handle) {}
+
+            handle_type handle;
+    };
+
+    // Awaitables returned by the functions below suspend the job without
+    // holding an executor thread. The job resumes on the executor.
+    struct wait_state;
+
+    struct sleep_awaitable {
+        std::chrono::steady_clock::duration duration;
+        std::shared_ptr<wait_state> state;
+
+        bool await_ready() const noexcept {
+            return duration.count() <= 0;
+        }
+        void await_suspend(std::coroutine_handle<> handle);
+        void await_resume();
+    };
+
+    struct process_awaitable {
+        pid_t pid;
+        std::shared_ptr<wait_state> state;
+
+        bool await_ready() const noexcept {
+            return false;
+        }
+        void await_suspend(std::coroutine_handle<> handle);
+        int await_resume();
+    };
+
+    struct file_awaitable {
+        std::string path;
+        std::string data;
+        bool write;
+        bool ok;
+
+        bool await_ready() const noexcept {
+            return false;
+        }
+        void await_suspend(std::coroutine_handle<> handle);
+        std::string await_resume();
+    };
+
+    // SleepFor resumes the job after the given duration, or earlier if
+    // the job is cancelled.
+    inline sleep_awaitable SleepFor(std::chrono::steady_clock::duration duration) {
+        return sleep_awaitable{ duration, nullptr };
+    }
+
+    // WaitProcess resumes the job once the given child process has
+    // exited and returns its wait status. If the job is cancelled, the
+    // process is killed.
+    inline process_awaitable WaitProcess(pid_t pid) {
+        return process_awaitable{ pid, nullptr };
+    }
+
+    // ReadFile resumes the job with the content of the given file.
+    // Throws if the file cannot be read.
+    inline file_awaitable ReadFile(std::string path) {
+        return file_awaitable{ std::move(path), std::string(), false, false };
+    }
+
+    // WriteFile resumes the job once data has been written to the given
+    // file. Throws if the file cannot be written.
+    inline file_awaitable WriteFile(std::string path, std::string data) {
+        return file_awaitable{ std::move(path), std::move(data), true, false };
+    }
+}
+
+#endif
@@ -0,0 +1,73 @@
+#include <utility>
+#include "wait_queue.h"
+
+WaitQueue::WaitQueue(std::mutex& mutex) : mutex(mutex), next_waiter(0) {}
+
+unsigned long WaitQueue::Push(const gaia::cancellation_token& token, std::function<void()> start, size_t job) {
+    unsigned long waiter = next_waiter++;
+    Waiter& entry = waiting[waiter];
+    entry.token = token;
+    entry.start = std::move(start);
+    entry.queued_at = std::chrono::steady_clock::now();
+    entry.job = job;
+    entry.cancel_id = CANCEL_ID_PENDING;
+    return waiter;
+}
+
+void WaitQueue::Watch(unsigned long waiter, std::function<void()> cancelled, Removed removed) {
+    gaia::cancellation_token token;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto found = waiting.find(waiter);
+        if (found == waiting.end()) {
+            return;
+        }
+        token = found->second.token;
+    }
+
+    // The callback is registered outside of the lock since it runs right
+    // away for a cancelled token. If the job has been started meanwhile,
+    // its callback is removed again.
+    int id = token.OnCancel([this, waiter, cancelled, removed]() {
+        Cancel(waiter, cancelled, removed);
+    });
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto found = waiting.find(waiter);
+        if (found != waiting.end()) {
+            found->second.cancel_id = id;
+            return;
+        }
+    }
+    token.Unregister(id);
+}
+
+WaitQueue::iterator WaitQueue::Take(iterator it, std::vector<Waiter>& ready) {
+    ready.push_back(std::move(it->second));
+    return waiting.erase(it);
+}
+
+void WaitQueue::Start(std::vector<Waiter>& ready) {
+    for (auto & next : ready) {
+        if (next.cancel_id >= 0) {
+            next.token.Unregister(next.cancel_id);
+        }
+        next.start();
+    }
+}
+
+void WaitQueue::Cancel(unsigned long waiter, const std::function<void()>& cancelled, const Removed& removed) {
+    std::vector<Waiter> ready;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto found = waiting.find(waiter);
+        if (found == waiting.end()) {
+            // Already started, the job sees the token itself.
+            return;
+        }
+        waiting.erase(found);
+        removed(ready);
+    }
+    Start(ready);
+    cancelled();
+}
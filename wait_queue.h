@@ -0,0 +1,80 @@
+#ifndef WAIT_QUEUE_H
+#define WAIT_QUEUE_H
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <vector>
+#include "sdk.h"
+
+// WaitQueue holds the jobs which wait for a slot in arrival order. A job
+// whose cancellation token fires leaves the queue without being started.
+// The queue is guarded by the mutex of its owner, which decides when a
+// waiter may start.
+class WaitQueue {
+    public:
+        struct Waiter {
+            gaia::cancellation_token token;
+            std::function<void()> start;
+            std::chrono::steady_clock::time_point queued_at;
+            // Owner defined, e.g. the registry position of the job.
+            size_t job;
+            int cancel_id;
+        };
+
+        // Removed is called with the lock held once a cancelled waiter has
+        // left the queue. Waiters which can start now go to ready.
+        typedef std::function<void(std::vector<Waiter>& ready)> Removed;
+
+        explicit WaitQueue(std::mutex& mutex);
+
+        // Push appends a waiter and returns its id. Called with the lock
+        // held.
+        unsigned long Push(const gaia::cancellation_token& token, std::function<void()> start, size_t job);
+
+        // Watch removes the waiter once its token fires while it waits.
+        // Then removed is called, the ready waiters are started and
+        // cancelled is called. Called without the lock.
+        void Watch(unsigned long waiter, std::function<void()> cancelled, Removed removed);
+
+        // Contains returns true if the waiter has not left the queue.
+        // Called with the lock held.
+        bool Contains(unsigned long waiter) const {
+            return waiting.find(waiter) != waiting.end();
+        }
+
+        bool Empty() const {
+            return waiting.empty();
+        }
+
+        // Waiters in arrival order. Called with the lock held.
+        typedef std::map<unsigned long, Waiter>::iterator iterator;
+        iterator begin() {
+            return waiting.begin();
+        }
+        iterator end() {
+            return waiting.end();
+        }
+
+        // Take moves the waiter to ready and returns the next one. Called
+        // with the lock held.
+        iterator Take(iterator it, std::vector<Waiter>& ready);
+
+        // Start starts the taken waiters. Called without the lock.
+        static void Start(std::vector<Waiter>& ready);
+
+    private:
+        // Marks a waiter whose cancel callback is not registered yet.
+        static const int CANCEL_ID_PENDING = -2;
+
+        std::mutex& mutex;
+        // Waiters keyed by their arrival, so the map is the queue.
+        std::map<unsigned long, Waiter> waiting;
+        unsigned long next_waiter;
+
+        void Cancel(unsigned long waiter, const std::function<void()>& cancelled, const Removed& removed);
+};
+
+#endif